@@ -0,0 +1,750 @@
+#include "Benchmarks.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <utility>
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include "internal/game/World.hpp"
+#include "internal/game/Settings.hpp"
+#include "internal/game/neutral/units/Virus.hpp"
+#include "internal/game/player/PlayerBase.hpp"
+#include "internal/game/units/RobotBase.hpp"
+#include "TEAMNAME/units/Robot.hpp"
+#include "internal/helper/AllocationCounter.hpp"
+#include "internal/helper/ScanKernel.hpp"
+#include "helper/Crc16.hpp"
+
+namespace oop::internal
+{
+
+namespace
+{
+
+/// @brief Distance of two floats in units in the last place (0 if they are equal, ignoring the sign of zero)
+int32_t UlpDistance(float lhs, float rhs)
+{
+    if (lhs == rhs)
+    {
+        return 0;
+    }
+    int32_t lhsBits = 0;
+    int32_t rhsBits = 0;
+    std::memcpy(&lhsBits, &lhs, sizeof(float));
+    std::memcpy(&rhsBits, &rhs, sizeof(float));
+    return std::abs(lhsBits - rhsBits);
+}
+
+/// @brief Checks that the headings match the std::atan2 reference up to the error of the scan kernel, the rest exactly
+bool IsMatching(const UnitScanResult& lhs, const UnitScanResult& rhs)
+{
+    return lhs.playerId == rhs.playerId && lhs.gid == rhs.gid && UlpDistance(lhs.heading, rhs.heading) <= ScanKernel::MAX_HEADING_ERROR_ULP
+           && lhs.distance == rhs.distance && lhs.health == rhs.health && lhs.isHQ == rhs.isHQ;
+}
+
+/// @brief Checks that the headings match the std::atan2 reference up to the error of the scan kernel, the rest exactly
+bool IsMatching(const ResourceScanResult& lhs, const ResourceScanResult& rhs)
+{
+    return lhs.gid == rhs.gid && UlpDistance(lhs.heading, rhs.heading) <= ScanKernel::MAX_HEADING_ERROR_ULP
+           && lhs.distance == rhs.distance && lhs.type == rhs.type && lhs.amount == rhs.amount;
+}
+
+template<typename T>
+bool IsMatching(const std::vector<T>& lhs, const std::vector<T>& rhs)
+{
+    return lhs.size() == rhs.size()
+           && std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](const T& l, const T& r) { return IsMatching(l, r); });
+}
+
+/// @brief Adds the bytes of the value to a FNV-1a hash
+template<typename T>
+void HashValue(uint64_t& hash, const T& value)
+{
+    std::array<unsigned char, sizeof(T)> bytes{};
+    std::memcpy(bytes.data(), &value, sizeof(T));
+    for (auto byte : bytes)
+    {
+        hash = (hash ^ byte) * 1099511628211ULL;
+    }
+}
+
+/// @brief Robot which hashes the health of every unit it scans and attacks the first enemy in range
+class ScanningRobot : public RobotBase
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] parent Player owning the robot
+    /// @param[in] position Position
+    /// @param[in] heading Initial heading
+    ScanningRobot(PlayerBase* parent, const Eigen::Vector2f& position, float heading)
+        : RobotBase(parent, position, heading) {}
+
+    /// Hash over the global ids and health of all units scanned so far
+    uint64_t m_scanHash = 1469598103934665603ULL;
+
+  private:
+    /// @brief Get the type of the unit
+    [[nodiscard]] std::string GetUnitTypeName() const override
+    {
+        return "Scanning robot";
+    }
+
+    /// @brief Make decisions
+    void Think(float /* deltaTime */) override
+    {
+        bool attacking = false;
+        for (const auto& unit : ScanForUnits())
+        {
+            HashValue(m_scanHash, unit.gid);
+            HashValue(m_scanHash, unit.health);
+            if (!attacking && unit.playerId != GetPlayer()->GetGid() && unit.distance <= GetAttackRange() && !IsReloadingWeapons())
+            {
+                DoAttack(unit.gid);
+                attacking = true;
+            }
+        }
+        if (!attacking)
+        {
+            DoMove(GetHeading());
+        }
+    }
+};
+
+} // namespace
+
+bool Benchmarks::UnitScan(const std::vector<size_t>& unitCounts)
+{
+    fmt::print("Unit scan (units spread uniformly over the board)\n");
+    fmt::print("{:>8} | {:>12} | {:>14} | {:>14} | {:>8} | {}\n", "Units", "Results/unit", "Lists [ms]", "Brute [ms]", "Speedup", "Matching");
+
+    World world;
+    World::Scope scope(world);
+
+    bool success = true;
+    std::vector<UnitScanResult> bruteForceScan;
+    for (auto unitCount : unitCounts)
+    {
+        StartGameWithViruses(world, unitCount);
+
+        double gridTime = Measure([&world]() {
+            world.RebuildNeighbourLists(glob::game::UPDATE_TIME_STEP);
+            for (const auto& player : world.m_players)
+            {
+                for (const auto& unit : player->m_units)
+                {
+                    unit->UpdateUnitScan();
+                }
+            }
+        });
+
+        bool matching = true;
+        size_t results = 0;
+        size_t units = 0;
+        for (const auto& player : world.m_players)
+        {
+            for (const auto& unit : player->m_units)
+            {
+                BruteForceUnitScan(world, *unit, bruteForceScan);
+                results += unit->m_currentUnitScan.size();
+                units++;
+                matching &= IsMatching(bruteForceScan, unit->m_currentUnitScan);
+            }
+        }
+
+        double bruteForceTime = Measure([&world, &bruteForceScan]() {
+            for (const auto& player : world.m_players)
+            {
+                for (const auto& unit : player->m_units)
+                {
+                    BruteForceUnitScan(world, *unit, bruteForceScan);
+                }
+            }
+        });
+
+        success &= matching;
+        fmt::print("{:>8} | {:>12.1f} | {:>14.4f} | {:>14.4f} | {:>7.1f}x | {}\n", unitCount,
+                   static_cast<double>(results) / static_cast<double>(units), gridTime * 1e3, bruteForceTime * 1e3,
+                   bruteForceTime / gridTime, matching ? "yes" : "NO");
+    }
+    return success;
+}
+
+bool Benchmarks::ResourceScan(const std::vector<size_t>& resourceCounts)
+{
+    constexpr size_t UNIT_COUNT = 1'000;
+
+    fmt::print("Resource scan ({} units, resources spread uniformly over the board)\n", UNIT_COUNT);
+    fmt::print("{:>8} | {:>12} | {:>14} | {:>14} | {:>8} | {}\n", "Res.", "Results/unit", "Grid [ms]", "Brute [ms]", "Speedup", "Matching");
+
+    World world;
+    World::Scope scope(world);
+
+    bool success = true;
+    std::vector<ResourceScanResult> bruteForceScan;
+    for (auto resourceCount : resourceCounts)
+    {
+        StartGameWithViruses(world, UNIT_COUNT);
+        SpawnResources(world, resourceCount - std::min(resourceCount, world.m_resources.size()));
+
+        double gridTime = Measure([&world]() {
+            for (const auto& player : world.m_players)
+            {
+                for (const auto& unit : player->m_units)
+                {
+                    unit->UpdateResourceScan();
+                }
+            }
+        });
+
+        bool matching = true;
+        size_t results = 0;
+        size_t units = 0;
+        for (const auto& player : world.m_players)
+        {
+            for (const auto& unit : player->m_units)
+            {
+                BruteForceResourceScan(world, *unit, bruteForceScan);
+                results += unit->m_currentResourceScan.size();
+                units++;
+                matching &= IsMatching(bruteForceScan, unit->m_currentResourceScan);
+            }
+        }
+
+        double bruteForceTime = Measure([&world, &bruteForceScan]() {
+            for (const auto& player : world.m_players)
+            {
+                for (const auto& unit : player->m_units)
+                {
+                    BruteForceResourceScan(world, *unit, bruteForceScan);
+                }
+            }
+        });
+
+        success &= matching;
+        fmt::print("{:>8} | {:>12.1f} | {:>14.4f} | {:>14.4f} | {:>7.1f}x | {}\n", world.m_resources.size(),
+                   static_cast<double>(results) / static_cast<double>(units), gridTime * 1e3, bruteForceTime * 1e3,
+                   bruteForceTime / gridTime, matching ? "yes" : "NO");
+    }
+    return success;
+}
+
+bool Benchmarks::BatchScan(const std::vector<size_t>& targetCounts)
+{
+    constexpr float RANGE = 25.0F;
+
+    fmt::print("Scan kernel (targets spread uniformly over a square of twice the range, detected: {})\n", ScanKernel::IsaName(ScanKernel::DetectedIsa()));
+    fmt::print("{:>8} | {:>12}", "Targets", "Libm [us]");
+    for (size_t isa = 0; isa < ScanKernel::Isa_COUNT; isa++)
+    {
+        fmt::print(" | {:>12}", fmt::format("{} [us]", ScanKernel::IsaName(static_cast<ScanKernel::Isa>(isa))));
+    }
+    fmt::print(" | {:>14} | {}\n", "Max error [ulp]", "Identical");
+
+    std::mt19937 engine(0); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::uniform_real_distribution<float> coordinateDistribution(-RANGE, RANGE);
+
+    bool success = true;
+    for (auto targetCount : targetCounts)
+    {
+        // The first targets lie on the center and the axes, where the arctangent switches its quadrant
+        std::vector<float> xs(targetCount);
+        std::vector<float> ys(targetCount);
+        for (size_t i = 0; i < targetCount; i++)
+        {
+            xs.at(i) = i < 9 ? static_cast<float>(i % 3) * RANGE / 2.0F - RANGE / 2.0F : coordinateDistribution(engine);
+            ys.at(i) = i < 9 ? static_cast<float>(i / 3) * RANGE / 2.0F - RANGE / 2.0F : coordinateDistribution(engine);
+        }
+
+        std::vector<uint32_t> libmIndices(targetCount);
+        std::vector<float> libmDistances(targetCount);
+        std::vector<float> libmHeadings(targetCount);
+        size_t libmFound = 0;
+        double libmTime = Measure([&]() {
+            libmFound = 0;
+            for (size_t i = 0; i < targetCount; i++)
+            {
+                Eigen::Vector2f diff{ xs.at(i), ys.at(i) };
+                auto diffNorm = diff.norm();
+                if (diffNorm <= RANGE)
+                {
+                    libmIndices.at(libmFound) = static_cast<uint32_t>(i);
+                    libmDistances.at(libmFound) = diffNorm;
+                    libmHeadings.at(libmFound) = std::atan2(-diff.x(), diff.y());
+                    libmFound++;
+                }
+            }
+        });
+
+        bool identical = true;
+        int32_t maxError = 0;
+        std::vector<uint32_t> indices(targetCount);
+        std::vector<float> distances(targetCount);
+        std::vector<float> headings(targetCount);
+        fmt::print("{:>8} | {:>12.3f}", targetCount, libmTime * 1e6);
+        for (size_t i = 0; i < ScanKernel::Isa_COUNT; i++)
+        {
+            auto isa = static_cast<ScanKernel::Isa>(i);
+            if (isa > ScanKernel::DetectedIsa())
+            {
+                fmt::print(" | {:>12}", "-");
+                continue;
+            }
+            size_t found = 0;
+            double time = Measure([&]() {
+                found = ScanKernel::Scan(0.0F, 0.0F, RANGE, xs.data(), ys.data(), targetCount, indices.data(), distances.data(), headings.data(), isa);
+            });
+            fmt::print(" | {:>12.3f}", time * 1e6);
+
+            // The indices and distances have to match the libm reference exactly, the headings up to the polynomial error
+            identical &= found == libmFound
+                         && std::equal(indices.begin(), indices.begin() + static_cast<std::ptrdiff_t>(found), libmIndices.begin())
+                         && std::equal(distances.begin(), distances.begin() + static_cast<std::ptrdiff_t>(found), libmDistances.begin());
+            for (size_t r = 0; r < std::min(found, libmFound); r++)
+            {
+                identical &= headings.at(r) == ScanKernel::Atan2(-xs.at(indices.at(r)), ys.at(indices.at(r)));
+                maxError = std::max(maxError, UlpDistance(headings.at(r), libmHeadings.at(r)));
+            }
+        }
+        success &= identical && maxError <= ScanKernel::MAX_HEADING_ERROR_ULP;
+        fmt::print(" | {:>14} | {}\n", maxError, identical ? "yes" : "NO");
+    }
+    return success;
+}
+
+void Benchmarks::SatelliteChecksum(const std::vector<size_t>& packetCounts)
+{
+    constexpr size_t MSG_LENGTH = 3 * sizeof(char) + 3 * sizeof(float); // Checksum covers sync bytes and floats
+
+    fmt::print("Satellite checksum ({} bytes per message)\n", MSG_LENGTH);
+    fmt::print("{:>8} | {:>12} | {:>12} | {:>8} | {}\n", "Msgs", "Shift [us]", "Table [us]", "Speedup", "Identical");
+
+    std::mt19937 engine(0); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+
+    for (auto packetCount : packetCounts)
+    {
+        std::vector<unsigned char> bytes(packetCount * MSG_LENGTH);
+        std::generate(bytes.begin(), bytes.end(), [&]() { return static_cast<unsigned char>(byteDistribution(engine)); });
+        std::vector<const unsigned char*> data(packetCount);
+        for (size_t i = 0; i < packetCount; i++)
+        {
+            data.at(i) = bytes.data() + i * MSG_LENGTH;
+        }
+
+        std::vector<uint16_t> shiftCrcs(packetCount);
+        std::vector<uint16_t> tableCrcs(packetCount);
+
+        double shiftTime = Measure([&]() {
+            for (size_t i = 0; i < packetCount; i++)
+            {
+                shiftCrcs.at(i) = ShiftCrc16(data.at(i), MSG_LENGTH);
+            }
+        });
+        double tableTime = Measure([&]() {
+            for (size_t i = 0; i < packetCount; i++)
+            {
+                tableCrcs.at(i) = oop::Crc16::Compute(data.at(i), MSG_LENGTH);
+            }
+        });
+
+        bool identical = shiftCrcs == tableCrcs;
+
+        fmt::print("{:>8} | {:>12.3f} | {:>12.3f} | {:>7.1f}x | {}\n", packetCount, shiftTime * 1e6, tableTime * 1e6,
+                   shiftTime / tableTime, identical ? "yes" : "NO");
+    }
+}
+
+std::vector<Benchmarks::PhaseResult> Benchmarks::Phases(const std::vector<WorldFixture>& fixtures)
+{
+    fmt::print("Update phases (robots, viruses, resources and satellites spread uniformly over the board)\n");
+    fmt::print("{:>7} | {:>7} | {:>7} | {:>4} | {:<22} | {:>12} | {:>13}\n", "Robots", "Viruses", "Res.", "Sats", "Phase", "Time [us]", "Per unit [ns]");
+
+    constexpr size_t TICK_COUNT = 100;
+    const float deltaTime = glob::game::UPDATE_TIME_STEP;
+
+    std::vector<PhaseResult> results;
+    for (const auto& fixture : fixtures)
+    {
+        World world;
+        World::Scope scope(world);
+        StartGame(world, fixture);
+        world.RebuildNeighbourLists(deltaTime);
+
+        size_t units = 0;
+        for (const auto& player : world.m_players)
+        {
+            units += player->m_units.size();
+        }
+
+        auto forAllUnits = [&world](const std::function<void(Unit&)>& func) {
+            for (const auto& player : world.m_players)
+            {
+                for (const auto& unit : player->m_units)
+                {
+                    func(*unit);
+                }
+            }
+        };
+
+        size_t checksum = 0;
+        const std::vector<std::pair<std::string, std::function<void()>>> phases{
+            { "neighbour_lists", [&]() { world.RebuildNeighbourLists(deltaTime); } },
+            { "unit_scan", [&]() { forAllUnits([](Unit& unit) { unit.UpdateUnitScan(); }); } },
+            { "resource_scan", [&]() { forAllUnits([](Unit& unit) {
+                                            if (unit.m_parent->m_gid) { unit.UpdateResourceScan(); }
+                                        }); } },
+            { "satellite_measurements", [&]() { forAllUnits([](Unit& unit) {
+                                                     if (unit.m_parent->m_gid) { unit.UpdateSatelliteMeasurements(); }
+                                                 }); } },
+            { "satellite_checksum", [&]() { forAllUnits([&checksum](Unit& unit) {
+                                                 for (const auto& packet : unit.GetSatellitePackets())
+                                                 {
+                                                     checksum += oop::Crc16::Compute(packet.data(), packet.size());
+                                                 }
+                                             }); } },
+            { "unit_costs", [&]() { forAllUnits([&checksum](Unit& unit) { checksum += unit.GetUnitCosts().at(0); }); } },
+            { "moves", [&]() {
+                 world.m_moveIntegrator.Clear();
+                 forAllUnits([&world](Unit& unit) {
+                     if (!unit.IsHeadquarters()) { world.m_moveIntegrator.Add(unit); }
+                 });
+                 world.m_moveIntegrator.Advance(deltaTime);
+             } },
+        };
+
+        auto addResult = [&](const std::string& phase, double time) {
+            results.push_back({ fixture, units, phase, time });
+            fmt::print("{:>7} | {:>7} | {:>7} | {:>4} | {:<22} | {:>12.3f} | {:>13.1f}\n", fixture.robots, fixture.viruses,
+                       fixture.resources, fixture.satellites, phase, time * 1e6, time * 1e9 / static_cast<double>(units));
+        };
+
+        // The moves change the positions, so they are restored before the ticks are measured
+        std::vector<Eigen::Vector2f> positions;
+        forAllUnits([&positions](Unit& unit) { positions.push_back(unit.m_pos); });
+        for (const auto& [phase, func] : phases)
+        {
+            addResult(phase, Measure(func));
+        }
+        size_t u = 0;
+        forAllUnits([&positions, &u](Unit& unit) { unit.m_pos = positions.at(u++); });
+        spdlog::debug("Checksum of the measured phases: {}", checksum);
+
+        // Repeating ticks for a fixed time would let the match end on small worlds, so a fixed amount is measured
+        auto startTime = std::chrono::steady_clock::now();
+        for (size_t tick = 0; tick < TICK_COUNT; tick++)
+        {
+            world.Update(deltaTime);
+        }
+        std::chrono::duration<double> tickDuration = std::chrono::steady_clock::now() - startTime;
+        addResult("tick", tickDuration.count() / static_cast<double>(TICK_COUNT));
+    }
+
+    // Spawning the match places all resources with World::GetNewResourcePosition. It always starts the default match,
+    // so it is measured once without a fixture and a time per unit
+    {
+        World world;
+        World::Scope scope(world);
+        world.m_gameRng.useSeedInsteadOfSystemTime = true;
+        world.m_gameRng.seed = 0;
+        const double time = Measure([&world]() { world.OnStart(); });
+        results.push_back({ WorldFixture{ 0, 0, 0, 0 }, 0, "match_start", time });
+        fmt::print("{:>7} | {:>7} | {:>7} | {:>4} | {:<22} | {:>12.3f} | {:>13}\n", "-", "-", "-", "-", "match_start", time * 1e6, "-");
+    }
+    return results;
+}
+
+bool Benchmarks::SteadyStateAllocations(const std::vector<WorldFixture>& fixtures)
+{
+    fmt::print("Steady state heap allocations (ticks with spawned objects are skipped)\n");
+    if constexpr (!AllocationCounter::ENABLED)
+    {
+        fmt::print("skipped, configure with -DENABLE_ALLOCATION_COUNTER=ON\n");
+        return true;
+    }
+
+    fmt::print("{:>7} | {:>7} | {:>7} | {:>4} | {:<10} | {:>7} | {:>7} | {:>11} | {}\n", "Robots", "Viruses", "Res.", "Sats", "Update", "Ticks", "Skipped", "Allocations", "Zero");
+
+    constexpr size_t WARM_UP_TICKS = 1000;
+    constexpr size_t TICK_COUNT = 3000;
+    const float deltaTime = glob::game::UPDATE_TIME_STEP;
+    const bool phasedUpdate = glob::game::PHASED_UPDATE;
+
+    bool success = true;
+    for (const auto& fixture : fixtures)
+    {
+        for (bool phased : { false, true })
+        {
+            glob::game::PHASED_UPDATE = phased;
+            World world;
+            World::Scope scope(world);
+            StartGame(world, fixture);
+
+            for (size_t tick = 0; tick < WARM_UP_TICKS; tick++)
+            {
+                world.Update(deltaTime);
+            }
+
+            size_t ticks = 0;
+            size_t skipped = 0;
+            uint64_t allocations = 0;
+            for (size_t tick = 0; tick < TICK_COUNT && world.m_gameRunning; tick++)
+            {
+                const size_t gidBefore = world.m_currentGid;
+                const uint64_t allocationsBefore = AllocationCounter::Count();
+                world.Update(deltaTime);
+                const uint64_t tickAllocations = AllocationCounter::Count() - allocationsBefore;
+                if (world.m_currentGid != gidBefore) // Every spawned object gets a new global id
+                {
+                    skipped++;
+                    continue;
+                }
+                ticks++;
+                allocations += tickAllocations;
+            }
+            success &= allocations == 0;
+
+            fmt::print("{:>7} | {:>7} | {:>7} | {:>4} | {:<10} | {:>7} | {:>7} | {:>11} | {}\n", fixture.robots, fixture.viruses,
+                       fixture.resources, fixture.satellites, phased ? "phased" : "sequential", ticks, skipped, allocations,
+                       allocations == 0 ? "yes" : "NO");
+        }
+    }
+    glob::game::PHASED_UPDATE = phasedUpdate;
+    return success;
+}
+
+bool Benchmarks::ThinkThreadDeterminism(const WorldFixture& fixture, const std::vector<size_t>& threadCounts)
+{
+    fmt::print("Phased update with different Think thread counts (robots hash the health of the units they scan)\n");
+    fmt::print("{:>7} | {:>7} | {:>7} | {:>4} | {:>7} | {:>7} | {:>16} | {}\n", "Robots", "Viruses", "Res.", "Sats", "Threads", "Ticks", "Scan hash", "Identical");
+
+    constexpr size_t TICK_COUNT = 2000;
+    const float deltaTime = glob::game::UPDATE_TIME_STEP;
+    const bool phasedUpdate = glob::game::PHASED_UPDATE;
+    const size_t thinkThreads = glob::game::THINK_THREADS;
+    glob::game::PHASED_UPDATE = true;
+
+    bool success = true;
+    uint64_t firstHash = 0;
+    for (size_t t = 0; t < threadCounts.size(); t++)
+    {
+        glob::game::THINK_THREADS = threadCounts.at(t);
+        World world;
+        World::Scope scope(world);
+        StartGameWithViruses(world, fixture.viruses);
+        for (size_t i = 0; i < fixture.robots && world.m_players.size() > 1; i++)
+        {
+            auto& player = world.m_players.at(1 + i % (world.m_players.size() - 1));
+            player->AddUnit(world.m_unitPool.Create<ScanningRobot>(player.get(), RandomBoardPosition(world), 0.0F));
+        }
+        SpawnResources(world, fixture.resources - std::min(fixture.resources, world.m_resources.size()));
+        world.m_gameRunning = true;
+
+        uint64_t hash = 1469598103934665603ULL;
+        size_t ticks = 0;
+        for (; ticks < TICK_COUNT && world.m_gameRunning; ticks++)
+        {
+            world.Update(deltaTime);
+            for (const auto& player : world.m_players)
+            {
+                for (const auto& unit : player->m_units)
+                {
+                    if (const auto* robot = dynamic_cast<const ScanningRobot*>(unit.get()))
+                    {
+                        HashValue(hash, robot->GetGid());
+                        HashValue(hash, robot->m_scanHash);
+                    }
+                }
+            }
+        }
+        if (t == 0)
+        {
+            firstHash = hash;
+        }
+        success &= hash == firstHash;
+
+        fmt::print("{:>7} | {:>7} | {:>7} | {:>4} | {:>7} | {:>7} | {:>16x} | {}\n", fixture.robots, fixture.viruses, fixture.resources,
+                   world.m_satellites.size(), threadCounts.at(t), ticks, hash, hash == firstHash ? "yes" : "NO");
+    }
+    glob::game::PHASED_UPDATE = phasedUpdate;
+    glob::game::THINK_THREADS = thinkThreads;
+    return success;
+}
+
+bool Benchmarks::WriteCsv(const std::string& path, const std::vector<PhaseResult>& results)
+{
+    std::ofstream file(path);
+    if (!file)
+    {
+        fmt::print(stderr, "Could not open the CSV file '{}'\n", path);
+        return false;
+    }
+
+    file << "robots,viruses,resources,satellites,units,phase,time_us,per_unit_ns\n";
+    for (const auto& result : results)
+    {
+        file << fmt::format("{},{},{},{},{},{},{:.4f},{}\n", result.fixture.robots, result.fixture.viruses,
+                            result.fixture.resources, result.fixture.satellites, result.units, result.phase, result.time * 1e6,
+                            result.units ? fmt::format("{:.4f}", result.time * 1e9 / static_cast<double>(result.units)) : "");
+    }
+    return static_cast<bool>(file);
+}
+
+bool Benchmarks::WriteJson(const std::string& path, const std::vector<PhaseResult>& results)
+{
+    std::ofstream file(path);
+    if (!file)
+    {
+        fmt::print(stderr, "Could not open the JSON file '{}'\n", path);
+        return false;
+    }
+
+    file << "{\n  \"phases\": [\n";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const auto& result = results.at(i);
+        file << fmt::format("    {{\"robots\": {}, \"viruses\": {}, \"resources\": {}, \"satellites\": {}, \"units\": {}, \"phase\": \"{}\", \"time_us\": {:.4f}, \"per_unit_ns\": {}}}{}\n",
+                            result.fixture.robots, result.fixture.viruses, result.fixture.resources, result.fixture.satellites,
+                            result.units, result.phase, result.time * 1e6,
+                            result.units ? fmt::format("{:.4f}", result.time * 1e9 / static_cast<double>(result.units)) : "null",
+                            i + 1 < results.size() ? "," : "");
+    }
+    file << "  ]\n}\n";
+    return static_cast<bool>(file);
+}
+
+void Benchmarks::StartGame(World& world, const WorldFixture& fixture)
+{
+    StartGameWithViruses(world, fixture.viruses);
+
+    for (size_t i = 0; i < fixture.robots && world.m_players.size() > 1; i++)
+    {
+        auto& player = world.m_players.at(1 + i % (world.m_players.size() - 1));
+        player->AddUnit(world.m_unitPool.Create<TEAMNAME::Robot>(player.get(), RandomBoardPosition(world), 0.0F));
+    }
+
+    SpawnResources(world, fixture.resources - std::min(fixture.resources, world.m_resources.size()));
+
+    while (world.m_satellites.size() < fixture.satellites)
+    {
+        auto [pos, heading] = world.GetNewSatellitePositionAndHeading();
+        world.SpawnSatellite(pos, heading);
+    }
+
+    world.m_gameRunning = true;
+}
+
+Eigen::Vector2f Benchmarks::RandomBoardPosition(World& world)
+{
+    return { world.m_gameRng.uniform_real_distribution<float>(glob::game::BOARD_WIDTH.at(0), glob::game::BOARD_WIDTH.at(1)),
+             world.m_gameRng.uniform_real_distribution<float>(glob::game::BOARD_HEIGHT.at(0), glob::game::BOARD_HEIGHT.at(1)) };
+}
+
+void Benchmarks::StartGameWithViruses(World& world, size_t count)
+{
+    world.m_gameRng.useSeedInsteadOfSystemTime = true;
+    world.m_gameRng.seed = 0;
+    world.OnStart();
+    world.m_gameRunning = false;
+
+    auto& neutralPlayer = world.m_players.front();
+    for (size_t i = 0; i < count; i++)
+    {
+        neutralPlayer->AddUnit(world.m_unitPool.Create<Virus>(neutralPlayer.get(), RandomBoardPosition(world), 0.0F));
+    }
+}
+
+void Benchmarks::SpawnResources(World& world, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        auto type = static_cast<ResourceType>(i % ResourceType_COUNT);
+        world.SpawnResource(type, 20, RandomBoardPosition(world), 0.0F);
+    }
+    world.RebuildResourceGrid();
+}
+
+void Benchmarks::BruteForceUnitScan(const World& world, const Unit& unit, std::vector<UnitScanResult>& scan)
+{
+    scan.clear();
+    for (const auto& player : world.m_players)
+    {
+        for (const auto& other : player->m_units)
+        {
+            if (unit.m_gid == other->m_gid)
+            {
+                continue;
+            }
+            Eigen::Vector2f diff = other->m_pos - unit.m_pos;
+            auto diffNorm = diff.norm();
+            if (diffNorm <= unit.m_scanRange)
+            {
+                diff.x() *= -1;
+                float heading = std::atan2(diff.x(), diff.y());
+
+                scan.push_back({ other->m_parent->m_gid, other->m_gid, heading, diffNorm, other->m_currentHealth, other->IsHeadquarters() });
+            }
+        }
+    }
+}
+
+void Benchmarks::BruteForceResourceScan(const World& world, const Unit& unit, std::vector<ResourceScanResult>& scan)
+{
+    scan.clear();
+    for (const auto& resource : world.m_resources)
+    {
+        Eigen::Vector2f diff = resource.m_pos - unit.m_pos;
+        auto diffNorm = diff.norm();
+        if (diffNorm <= unit.m_scanRange)
+        {
+            diff.x() *= -1;
+            float heading = std::atan2(diff.x(), diff.y());
+
+            scan.push_back({ resource.m_gid, heading, diffNorm, resource.m_type, resource.m_amount });
+        }
+    }
+}
+
+uint16_t Benchmarks::ShiftCrc16(const unsigned char* data, size_t length)
+{
+    uint16_t crc = 0;
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        crc = static_cast<uint16_t>((crc >> 8) | (crc << 8));
+
+        crc = static_cast<uint16_t>(crc ^ static_cast<uint8_t>(data[i]));
+        crc ^= static_cast<uint16_t>(static_cast<uint8_t>(crc & 0xFF) >> 4);
+        crc ^= static_cast<uint16_t>((crc << 8) << 4);
+        crc ^= static_cast<uint16_t>(((crc & 0xFF) << 4) << 1);
+    }
+
+    return crc;
+}
+
+double Benchmarks::Measure(const std::function<void()>& func)
+{
+    constexpr double MIN_MEASUREMENT_TIME = 0.25; // [s]
+
+    func(); // Warm up
+
+    size_t calls = 0;
+    auto startTime = std::chrono::steady_clock::now();
+    std::chrono::duration<double> duration{};
+    do
+    {
+        func();
+        calls++;
+        duration = std::chrono::steady_clock::now() - startTime;
+    } while (duration.count() < MIN_MEASUREMENT_TIME);
+
+    return duration.count() / static_cast<double>(calls);
+}
+
+} // namespace oop::internal
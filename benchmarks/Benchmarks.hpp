@@ -0,0 +1,147 @@
+/// @file Benchmarks.hpp
+/// @brief Performance measurements of the game logic
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "internal/game/World.hpp"
+#include "internal/game/Settings.hpp"
+#include "internal/game/units/Unit.hpp"
+
+namespace oop::internal
+{
+
+/// @brief Collection of benchmarks which run on their own headless world
+class Benchmarks
+{
+  public:
+    /// @brief Default constructor
+    Benchmarks() = delete;
+
+    /// @brief Size of a world to measure
+    struct WorldFixture
+    {
+        size_t robots = 0;                                                  ///< Robots spread over the players (besides the headquarters)
+        size_t viruses = 0;                                                 ///< Viruses of the neutral player
+        size_t resources = 0;                                               ///< Resources on the board (at least the ones of the match start)
+        size_t satellites = static_cast<size_t>(glob::positioning::NUM_SAT); ///< Satellites on the board
+    };
+
+    /// @brief Time of a phase of the update measured on a world fixture
+    struct PhaseResult
+    {
+        WorldFixture fixture; ///< Fixture the phase was measured on (all zero if the phase does not depend on it)
+        size_t units = 0;     ///< Amount of units in the world including the headquarters (0 without fixture)
+        std::string phase;    ///< Name of the phase
+        double time = 0.0;    ///< Average time per call in [s]
+    };
+
+    /// @brief Measures the unit scan for different amounts of units and compares it to the brute-force scan
+    /// @param[in] unitCounts Amounts of units to measure
+    /// @return False if a scan differs from the brute-force scan (headings up to the error of the scan kernel)
+    static bool UnitScan(const std::vector<size_t>& unitCounts);
+
+    /// @brief Measures the resource scan for different amounts of resources and compares it to the brute-force scan
+    /// @param[in] resourceCounts Amounts of resources to measure
+    /// @return False if a scan differs from the brute-force scan (headings up to the error of the scan kernel)
+    static bool ResourceScan(const std::vector<size_t>& resourceCounts);
+
+    /// @brief Measures the scan kernel with every instruction set the CPU supports and compares it to std::atan2
+    /// @param[in] targetCounts Amounts of targets per scan
+    /// @return False if an instruction set differs from the scalar path or a heading exceeds the error bound
+    static bool BatchScan(const std::vector<size_t>& targetCounts);
+
+    /// @brief Measures the CRC-16 engine on satellite messages and compares it to the byte wise shift implementation
+    /// @param[in] packetCounts Amounts of messages to check
+    static void SatelliteChecksum(const std::vector<size_t>& packetCounts);
+
+    /// @brief Measures the phases of an update and a complete tick for worlds of different sizes.
+    ///
+    /// The phases are measured on the unchanged world one after another. Afterwards the complete tick is measured
+    /// over a fixed amount of ticks, because the world evolves while it runs. The start of a new match does not depend on
+    /// the fixtures and is measured once at the end.
+    /// @param[in] fixtures Sizes of the worlds to measure
+    /// @return The time of every phase on every fixture
+    static std::vector<PhaseResult> Phases(const std::vector<WorldFixture>& fixtures);
+
+    /// @brief Checks that ticks do not allocate heap memory once the world reached its steady state after a warm-up.
+    ///
+    /// Every fixture is run with the sequential and the phased update. Ticks in which units, resources or satellites
+    /// were spawned are skipped, as the new objects have to be allocated. Needs the allocation counter (CMake option
+    /// ENABLE_ALLOCATION_COUNTER or a Debug build), otherwise the check is skipped.
+    /// @param[in] fixtures Sizes of the worlds to check
+    /// @return False if a tick without spawns allocated
+    static bool SteadyStateAllocations(const std::vector<WorldFixture>& fixtures);
+
+    /// @brief Checks that the phased update gives the same results for every amount of Think threads.
+    ///
+    /// The robots of the world hash the health of every unit they scan and attack the first enemy in range, so that
+    /// the health changes by the attacks, the regeneration and the healing.
+    /// @param[in] fixture Size of the world to check (the satellites are spawned by the updates)
+    /// @param[in] threadCounts Amounts of Think threads to compare with the first one
+    /// @return False if the hashes of the scans differ between the thread counts
+    static bool ThinkThreadDeterminism(const WorldFixture& fixture, const std::vector<size_t>& threadCounts);
+
+    /// @brief Writes the phase times as CSV file with a row per fixture and phase
+    /// @param[in] path Path of the file
+    /// @param[in] results Results of Phases()
+    /// @return True if the file could be written
+    static bool WriteCsv(const std::string& path, const std::vector<PhaseResult>& results);
+
+    /// @brief Writes the phase times as JSON file
+    /// @param[in] path Path of the file
+    /// @param[in] results Results of Phases()
+    /// @return True if the file could be written
+    static bool WriteJson(const std::string& path, const std::vector<PhaseResult>& results);
+
+  private:
+    /// @brief Starts a new running game with the size of the fixture
+    /// @param[in, out] world World to start the game in
+    /// @param[in] fixture Size of the world
+    static void StartGame(World& world, const WorldFixture& fixture);
+
+    /// @brief Draws a position uniformly distributed over the board from the game random number generator
+    /// @param[in, out] world World whose generator is used
+    static Eigen::Vector2f RandomBoardPosition(World& world);
+
+    /// @brief Starts a new game with the given amount of additional viruses spread uniformly over the board
+    /// @param[in, out] world World to start the game in
+    /// @param[in] count Amount of viruses to spawn
+    static void StartGameWithViruses(World& world, size_t count);
+
+    /// @brief Scans for units by checking every unit on the board
+    /// @param[in] world World the unit is in
+    /// @param[in] unit Unit which scans
+    /// @param[out] scan Scan results
+    static void BruteForceUnitScan(const World& world, const Unit& unit, std::vector<UnitScanResult>& scan);
+
+    /// @brief Adds resources spread uniformly over the board
+    /// @param[in, out] world World to add the resources to
+    /// @param[in] count Amount of resources to spawn
+    static void SpawnResources(World& world, size_t count);
+
+    /// @brief Scans for resources by checking every resource on the board
+    /// @param[in] world World the unit is in
+    /// @param[in] unit Unit which scans
+    /// @param[out] scan Scan results
+    static void BruteForceResourceScan(const World& world, const Unit& unit, std::vector<ResourceScanResult>& scan);
+
+    /// @brief CRC-16/XModem which shifts every byte through the register (implementation used before the table engine)
+    /// @param[in] data Pointer to the first byte
+    /// @param[in] length Amount of bytes
+    static uint16_t ShiftCrc16(const unsigned char* data, size_t length);
+
+    /// @brief Calls the function repeatedly till the minimum measurement time passed
+    /// @param[in] func Function to measure
+    /// @return Average time per call in [s]
+    static double Measure(const std::function<void()>& func);
+};
+
+} // namespace oop::internal
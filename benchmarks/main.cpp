@@ -0,0 +1,80 @@
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include "Benchmarks.hpp"
+
+namespace
+{
+
+void PrintUsage(const char* executable)
+{
+    fmt::print("Usage: {} [--csv <file>] [--json <file>]\n"
+               "  --csv   Write the update phase times of every world size to the file\n"
+               "  --json  Write the update phase times of every world size to the file\n",
+               executable);
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    std::string csvPath;
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string_view arg = argv[i];
+        if (arg == "--help" || arg == "-h" || i + 1 >= argc)
+        {
+            PrintUsage(argv[0]);
+            return arg == "--help" || arg == "-h" ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+
+        std::string value = argv[++i];
+        if (arg == "--csv")
+        {
+            csvPath = value;
+        }
+        else if (arg == "--json")
+        {
+            jsonPath = value;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    spdlog::set_level(spdlog::level::warn);
+
+    bool success = oop::internal::Benchmarks::UnitScan({ 10, 100, 1'000, 10'000 });
+    success &= oop::internal::Benchmarks::ResourceScan({ 100, 1'000, 10'000 });
+    success &= oop::internal::Benchmarks::BatchScan({ 16, 256, 4'096, 65'536 });
+    oop::internal::Benchmarks::SatelliteChecksum({ 6, 64, 1'000, 100'000 });
+
+    // Scaling over the amount of units and resources, then over the amount of satellites
+    auto results = oop::internal::Benchmarks::Phases({ { 50, 50, 100, 6 },
+                                                       { 500, 500, 1'000, 6 },
+                                                       { 5'000, 5'000, 10'000, 6 },
+                                                       { 500, 500, 1'000, 24 },
+                                                       { 500, 500, 1'000, 96 } });
+
+    // The worlds keep their size over the checked ticks (larger worlds change by the fights between robots and viruses)
+    success &= oop::internal::Benchmarks::SteadyStateAllocations({ { 50, 50, 100, 6 },
+                                                                  { 200, 200, 400, 6 } });
+    success &= oop::internal::Benchmarks::ThinkThreadDeterminism({ 100, 100, 200, 6 }, { 1, 2, 4 });
+    if (!csvPath.empty())
+    {
+        success &= oop::internal::Benchmarks::WriteCsv(csvPath, results);
+    }
+    if (!jsonPath.empty())
+    {
+        success &= oop::internal::Benchmarks::WriteJson(jsonPath, results);
+    }
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
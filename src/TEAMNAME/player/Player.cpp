@@ -7,7 +7,7 @@
 namespace oop::TEAMNAME
 {
 
-Player::Player(const Eigen::Vector2f& position, const ImColor& color)
+Player::Player(const Eigen::Vector2f& position, const Color& color)
     : internal::PlayerBase(position, color)
 {
     m_name = "Set player name here";
@@ -15,7 +15,7 @@ Player::Player(const Eigen::Vector2f& position, const ImColor& color)
     // Add starting units
     for (size_t i = 0; i < 3; i++)
     {
-        SpawnUnit(std::make_shared<Robot>(this, Eigen::Vector2f{}, 0.0F));
+        SpawnUnit<Robot>(this, Eigen::Vector2f{}, 0.0F);
     }
 }
 
@@ -15,7 +15,7 @@ class Player : public internal::PlayerBase
     /// @brief Default Constructor
     /// @param[in] position Position of the headquarter
     /// @param[in] color Color of the player
-    Player(const Eigen::Vector2f& position, const ImColor& color);
+    Player(const Eigen::Vector2f& position, const Color& color);
 
     /// @brief Destructor
     ~Player() override = default;
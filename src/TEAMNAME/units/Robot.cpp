@@ -2,8 +2,10 @@
 
 #include <spdlog/spdlog.h>
 
-#include <implot.h>
-#include "internal/gui/helper/ImPlotHelper.hpp"
+#ifndef OOP_HEADLESS // Drawing is not available in headless builds
+    #include <implot.h>
+    #include "internal/gui/helper/ImPlotHelper.hpp"
+#endif
 #include "helper/RandomNumber.hpp"
 #include "internal/game/Settings.hpp"
 
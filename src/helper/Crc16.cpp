@@ -0,0 +1,69 @@
+#include "Crc16.hpp"
+
+#include <array>
+
+namespace oop
+{
+
+namespace
+{
+
+/// Generator polynomial of CRC-16/XModem
+constexpr uint16_t POLYNOMIAL = 0x1021;
+
+/// Amount of bytes processed per step with the sliced tables
+constexpr size_t SLICES = 8;
+
+/// Table k holds the checksum of a byte followed by k zero bytes
+using SliceTables = std::array<std::array<uint16_t, 256>, SLICES>;
+
+constexpr SliceTables GenerateTables()
+{
+    SliceTables tables{};
+    for (size_t byte = 0; byte < 256; byte++)
+    {
+        auto crc = static_cast<uint16_t>(byte << 8);
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = static_cast<uint16_t>((crc & 0x8000) ? (crc << 1) ^ POLYNOMIAL : crc << 1);
+        }
+        tables[0][byte] = crc;
+    }
+    for (size_t slice = 1; slice < SLICES; slice++)
+    {
+        for (size_t byte = 0; byte < 256; byte++)
+        {
+            const uint16_t previous = tables[slice - 1][byte];
+            tables[slice][byte] = static_cast<uint16_t>((previous << 8) ^ tables[0][previous >> 8]);
+        }
+    }
+    return tables;
+}
+
+constexpr SliceTables TABLES = GenerateTables();
+
+/// Processes a single byte with the first table
+inline uint16_t Update(uint16_t crc, unsigned char byte)
+{
+    return static_cast<uint16_t>((crc << 8) ^ TABLES[0][(crc >> 8) ^ byte]);
+}
+
+} // namespace
+
+uint16_t Crc16::Compute(const unsigned char* data, size_t length)
+{
+    uint16_t crc = 0;
+    for (; length >= SLICES; data += SLICES, length -= SLICES)
+    {
+        crc = static_cast<uint16_t>(TABLES[7][data[0] ^ (crc >> 8)] ^ TABLES[6][data[1] ^ (crc & 0xFF)]
+                                    ^ TABLES[5][data[2]] ^ TABLES[4][data[3]] ^ TABLES[3][data[4]]
+                                    ^ TABLES[2][data[5]] ^ TABLES[1][data[6]] ^ TABLES[0][data[7]]);
+    }
+    for (; length > 0; data++, length--)
+    {
+        crc = Update(crc, *data);
+    }
+    return crc;
+}
+
+} // namespace oop
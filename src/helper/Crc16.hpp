@@ -0,0 +1,29 @@
+/// @file Crc16.hpp
+/// @brief CRC-16/XModem checksum used by the satellite distance measurements
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace oop
+{
+
+/// @brief CRC-16/XModem (polynomial 0x1021, initial value 0, not reflected).
+///
+/// The checksum of a satellite distance measurement is calculated over the sync bytes and the three floats
+/// and is transmitted big endian in the last two bytes of the message.
+class Crc16
+{
+  public:
+    Crc16() = delete;
+
+    /// @brief Calculates the checksum of a single buffer
+    /// @param[in] data Pointer to the first byte
+    /// @param[in] length Amount of bytes
+    [[nodiscard]] static uint16_t Compute(const unsigned char* data, size_t length);
+};
+
+} // namespace oop
@@ -1,9 +1,13 @@
 #include "GameApplication.hpp"
 
+#include <algorithm>
+
 #include <imgui.h>
 #include "gui/Renderer.hpp"
+#include "gui/main/ProfilerPanel.hpp"
 #include "game/GameState.hpp"
 #include "game/Settings.hpp"
+#include "helper/Profiler.hpp"
 
 namespace oop::internal
 {
@@ -21,6 +25,7 @@ void GameApplication::OnStart()
 
 void GameApplication::OnStop()
 {
+    GameState::OnStop();
     Renderer::OnStop();
 
     auto releaseTexture = [this](ImTextureID& id) {
@@ -39,21 +44,31 @@ void GameApplication::OnStop()
 
 void GameApplication::OnFrame(float deltaTime)
 {
-    Renderer::RenderFrame();
-
-    float gameTimePassedThisFrame = deltaTime * gameTimeModifier;
-    float dt = glob::game::UPDATE_TIME_STEP; // std::min(gameTimePassedThisFrame, glob::game::UPDATE_TIME_STEP);
-
-    while (gameTimePassedThisFrame > 0)
+    OOP_PROFILE_ZONE("Frame");
+    auto& simulation = GameState::simulation;
+    if (simulation.FetchRenderState())
     {
-        GameState::Update(dt);
-        if (gameRunning)
+        const auto& state = simulation.GetRenderState();
+        if (state.gameRunning)
+        {
+            EndSlowDownGame(std::max(state.gameTime - slowDownLastGameTime, 0.0F));
+        }
+        if (controlledCamera && state.attacks != slowDownLastAttacks)
         {
-            gameTime += dt;
+            BeginSlowDownGame();
         }
+        slowDownLastGameTime = state.gameTime;
+        slowDownLastAttacks = state.attacks;
+    }
+    simulation.SetGameTimeModifier(gameTimeModifier);
+    simulation.SetCaptureScanLines(glob::debug::DRAW_OBJECTS_IN_SCAN_RANGE);
 
-        gameTimePassedThisFrame -= dt;
+    {
+        OOP_PROFILE_ZONE("Render");
+        Renderer::RenderFrame();
     }
+
+    ProfilerPanel::RecordFrame(deltaTime, simulation.GetRenderState());
 }
 
 void GameApplication::BeginSlowDownGame()
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <application.h>
 #include <imgui.h>
 
@@ -35,21 +37,6 @@ class GameApplication : public Application
     /// @brief Multiplicator for the game time
     static inline float gameTimeModifier = 1.0F;
 
-    /// @brief Time of this run
-    static inline float gameTime = 0.0F;
-
-    /// @brief Game time limit in seconds
-    static inline int32_t gameTimeLimit = 3600;
-
-    /// @brief Flag whether the game is running
-    static inline bool gameRunning = false;
-
-    /// @brief Flag whether the game is finished
-    static inline int gameFinished = 0;
-
-    /// @brief Flag whether the game is finished
-    static inline ImColor winningPlayerColor{ 0, 0, 0, 0 };
-
     /// @brief Texture of a coil (1909x417)
     static inline ImTextureID coilTexture = nullptr;
 
@@ -71,23 +58,22 @@ class GameApplication : public Application
     static inline float slowDownCounterTime = 0.0F;
     /// @brief Game time modifier backup
     static inline float slowDownGameTimeModifierBackup = 0.0F;
+    /// @brief Game time of the last render state
+    static inline float slowDownLastGameTime = 0.0F;
+    /// @brief Amount of updates with attacks of the last render state
+    static inline uint64_t slowDownLastAttacks = 0;
 
     /// @brief Slows down the game when attacks happen during controlled camera mode
     static void BeginSlowDownGame();
 
     /// @brief Ends the slow down during controlled camera mode
-    /// @param[in] deltaTime Time since last frame
+    /// @param[in] deltaTime Game time passed since the last call
     static void EndSlowDownGame(float deltaTime);
 
-    friend class RandomNumberGenerator;
-    friend class GlobalWindows;
     friend class ControlPanel;
     friend class GamePlot;
-    friend class GameState;
-    friend class Satellite;
-    friend class Resource;
-    friend class Virus;
-    friend class Unit;
+    friend class ProfilerPanel;
+    friend struct RenderState;
 };
 
 } // namespace oop::internal
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "HeadlessApplication.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <optional>
+#include <fmt/core.h>
+
+#include "game/World.hpp"
+#include "game/Settings.hpp"
+#include "game/units/Unit.hpp"
+#include "helper/Profiler.hpp"
+#include "Replay.hpp"
+#include "Snapshot.hpp"
+
+namespace oop::internal
+{
+
+int HeadlessApplication::Run(uint64_t seed, size_t ticks, float timeStep, const std::string& tracePath, const std::string& replayPath,
+                             const std::string& restorePath, const std::string& snapshotPath)
+{
+    glob::game::UPDATE_TIME_STEP = timeStep;
+
+    World world;
+    world.m_gameRng.useSeedInsteadOfSystemTime = true;
+    world.m_gameRng.seed = seed;
+
+    if (restorePath.empty())
+    {
+        world.OnStart();
+    }
+    else if (!Snapshot::Load(world, restorePath))
+    {
+        return EXIT_FAILURE;
+    }
+    world.m_gameRunning = true;
+
+    std::optional<Replay::Recorder> recorder;
+    if (!replayPath.empty())
+    {
+        recorder.emplace(replayPath, world);
+        if (!recorder->IsOpen())
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    size_t tick = 0;
+    for (; tick < ticks && !world.m_gameFinished; ++tick)
+    {
+        world.Update(timeStep);
+        if (recorder)
+        {
+            recorder->RecordTick(world);
+        }
+    }
+
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+
+    fmt::print("Seed:      {}\n", world.m_gameRng.seed);
+    fmt::print("Ticks:     {} ({:.0f} ticks/s)\n", tick, duration.count() > 0.0 ? static_cast<double>(tick) / duration.count() : 0.0);
+    fmt::print("Game time: {:.2f} s\n", world.m_gameTime);
+    fmt::print("Finished:  {}\n", world.m_gameFinished ? "yes" : "no");
+    if (recorder)
+    {
+        fmt::print("Replay:    {} (state {:016x})\n", replayPath, recorder->StateHash());
+    }
+    if (!snapshotPath.empty())
+    {
+        if (!Snapshot::Save(world, snapshotPath))
+        {
+            return EXIT_FAILURE;
+        }
+        fmt::print("Snapshot:  {} (tick {})\n", snapshotPath, world.m_tick);
+    }
+
+    for (const auto& player : world.m_players)
+    {
+        if (!player->m_gid) // Neutral player
+        {
+            fmt::print("Virus:     {} units\n", player->m_units.size());
+            continue;
+        }
+
+        size_t resSum = 0;
+        for (uint8_t resType = 0; resType < ResourceType_COUNT; ++resType)
+        {
+            resSum += player->m_collectedResourcesTotal.at(resType);
+        }
+        fmt::print("Player {} '{}': {} units, {}, collected {} [{}, {}, {}]\n",
+                   player->m_gid, player->GetName(), player->m_units.empty() ? 0 : player->m_units.size() - 1, player->m_isAlive ? "alive" : "dead", resSum,
+                   player->m_collectedResourcesTotal.at(ResourceType_Capacitor),
+                   player->m_collectedResourcesTotal.at(ResourceType_Coil),
+                   player->m_collectedResourcesTotal.at(ResourceType_Resistor));
+    }
+
+    if (!tracePath.empty() && !Profiler::WriteChromeTrace(tracePath))
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace oop::internal
@@ -0,0 +1,35 @@
+/// @file HeadlessApplication.hpp
+/// @brief Runs the game without any GUI
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace oop::internal
+{
+
+/// @brief Application class which simulates a game as fast as possible without a window
+class HeadlessApplication
+{
+  public:
+    /// @brief Default constructor
+    HeadlessApplication() = delete;
+
+    /// @brief Simulates a single game and prints the results
+    /// @param[in] seed Seed for the game random number generator
+    /// @param[in] ticks Maximum amount of updates to perform (the game can finish earlier)
+    /// @param[in] timeStep Time step of a single update in [s]
+    /// @param[in] tracePath Path to write the timing zones to as Chrome trace (empty to skip)
+    /// @param[in] replayPath Path to record the match to as replay (empty to skip)
+    /// @param[in] restorePath Path of a snapshot to continue instead of starting a new match with the seed (empty to skip)
+    /// @param[in] snapshotPath Path to save a snapshot of the world to after the last update (empty to skip)
+    /// @return Exit code of the application
+    static int Run(uint64_t seed, size_t ticks, float timeStep, const std::string& tracePath, const std::string& replayPath,
+                   const std::string& restorePath, const std::string& snapshotPath);
+};
+
+} // namespace oop::internal
@@ -0,0 +1,345 @@
+#include "Replay.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fmt/core.h>
+
+#include "game/World.hpp"
+#include "game/Settings.hpp"
+#include "game/units/Unit.hpp"
+
+namespace oop::internal
+{
+
+namespace
+{
+
+/// First bytes of every replay file
+constexpr std::array<char, 8> MAGIC = { 'O', 'O', 'P', 'R', 'P', 'L', 'A', 'Y' };
+
+/// Version of the file format
+constexpr uint32_t VERSION = 1;
+
+/// Size of the header in bytes
+constexpr size_t HEADER_SIZE = MAGIC.size() + sizeof(uint32_t) + sizeof(uint64_t) + sizeof(float) + sizeof(int32_t)
+                               + 5 * sizeof(uint8_t) + 3 * sizeof(uint32_t);
+
+/// Size of the action of a single unit in a record (global id, action, target global id, heading)
+constexpr size_t UNIT_ACTION_SIZE = sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint32_t) + sizeof(float);
+
+/// Start value of the FNV-1a hash
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+
+/// Multiplier of the FNV-1a hash
+constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+/// Settings of a match which have to match to reproduce it
+struct Header
+{
+    uint64_t seed = 0;                     ///< Seed of the game random number generator
+    float timeStep = 0.0F;                 ///< Time step of a single update in [s]
+    int32_t gameTimeLimit = 0;             ///< Game time limit in [s]
+    uint8_t phasedUpdate = 0;              ///< glob::game::PHASED_UPDATE
+    uint8_t randomStreams = 0;             ///< glob::game::RANDOM_STREAMS
+    uint8_t enablePvp = 0;                 ///< glob::game::ENABLE_PVP
+    uint8_t enableHeadingPrecision = 0;    ///< glob::game::ENABLE_HEADING_PRECISION
+    uint8_t enableDistanceClockOffset = 0; ///< glob::game::ENABLE_DISTANCE_CLOCK_OFFSET
+    uint32_t numPlayers = 0;               ///< glob::game::NUM_PLAYERS
+    uint32_t neutralUnits = 0;             ///< glob::game::NEUTRAL_UNITS
+    uint32_t numSatellites = 0;            ///< glob::positioning::NUM_SAT
+};
+
+/// Header with the settings of this build and the given runtime values
+Header CurrentSettings(uint64_t seed, float timeStep, int32_t gameTimeLimit)
+{
+    return { seed, timeStep, gameTimeLimit,
+             glob::game::PHASED_UPDATE, glob::game::RANDOM_STREAMS,
+             glob::game::ENABLE_PVP, glob::game::ENABLE_HEADING_PRECISION, glob::game::ENABLE_DISTANCE_CLOCK_OFFSET,
+             static_cast<uint32_t>(glob::game::NUM_PLAYERS), static_cast<uint32_t>(glob::game::NEUTRAL_UNITS),
+             static_cast<uint32_t>(glob::positioning::NUM_SAT) };
+}
+
+template<typename T>
+void Append(std::vector<unsigned char>& buffer, const T& value)
+{
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&value); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template<typename T>
+T Extract(const unsigned char*& data)
+{
+    T value{};
+    std::memcpy(&value, data, sizeof(T));
+    data += sizeof(T);
+    return value;
+}
+
+std::vector<unsigned char> SerializeHeader(const Header& header)
+{
+    std::vector<unsigned char> buffer(MAGIC.begin(), MAGIC.end());
+    Append(buffer, VERSION);
+    Append(buffer, header.seed);
+    Append(buffer, header.timeStep);
+    Append(buffer, header.gameTimeLimit);
+    Append(buffer, header.phasedUpdate);
+    Append(buffer, header.randomStreams);
+    Append(buffer, header.enablePvp);
+    Append(buffer, header.enableHeadingPrecision);
+    Append(buffer, header.enableDistanceClockOffset);
+    Append(buffer, header.numPlayers);
+    Append(buffer, header.neutralUnits);
+    Append(buffer, header.numSatellites);
+    return buffer;
+}
+
+/// Fills the header from the bytes and returns false if they are no replay of this version
+bool DeserializeHeader(const std::array<unsigned char, HEADER_SIZE>& buffer, Header& header)
+{
+    if (std::memcmp(buffer.data(), MAGIC.data(), MAGIC.size()) != 0)
+    {
+        return false;
+    }
+    const unsigned char* data = buffer.data() + MAGIC.size();
+    if (Extract<uint32_t>(data) != VERSION)
+    {
+        return false;
+    }
+    header.seed = Extract<uint64_t>(data);
+    header.timeStep = Extract<float>(data);
+    header.gameTimeLimit = Extract<int32_t>(data);
+    header.phasedUpdate = Extract<uint8_t>(data);
+    header.randomStreams = Extract<uint8_t>(data);
+    header.enablePvp = Extract<uint8_t>(data);
+    header.enableHeadingPrecision = Extract<uint8_t>(data);
+    header.enableDistanceClockOffset = Extract<uint8_t>(data);
+    header.numPlayers = Extract<uint32_t>(data);
+    header.neutralUnits = Extract<uint32_t>(data);
+    header.numSatellites = Extract<uint32_t>(data);
+    return true;
+}
+
+} // namespace
+
+Replay::Recorder::Recorder(const std::string& path, const World& world)
+    : m_file(path, std::ios::binary | std::ios::trunc), m_stateHash(FNV_OFFSET_BASIS)
+{
+    if (!m_file)
+    {
+        fmt::print(stderr, "Could not open the replay file '{}'\n", path);
+        return;
+    }
+
+    auto header = SerializeHeader(CurrentSettings(world.m_gameRng.seed, glob::game::UPDATE_TIME_STEP, world.m_gameTimeLimit));
+    m_file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size())); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+bool Replay::Recorder::IsOpen() const
+{
+    return static_cast<bool>(m_file);
+}
+
+void Replay::Recorder::RecordTick(const World& world)
+{
+    if (!m_file)
+    {
+        return;
+    }
+
+    m_stateHash = HashState(world, m_stateHash);
+    WriteRecord(world, m_stateHash, m_record);
+    m_file.write(reinterpret_cast<const char*>(m_record.data()), static_cast<std::streamsize>(m_record.size())); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+uint64_t Replay::HashState(const World& world, uint64_t previous)
+{
+    uint64_t hash = previous;
+    auto add = [&hash](const auto& value) {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(&value); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        for (size_t i = 0; i < sizeof(value); i++)
+        {
+            hash = (hash ^ bytes[i]) * FNV_PRIME;
+        }
+    };
+
+    add(world.m_gameTime);
+    add(world.m_gameFinished);
+    for (const auto& player : world.m_players)
+    {
+        add(player->m_gid);
+        add(player->m_isAlive);
+        add(player->m_resources);
+        for (const auto& unit : player->m_units)
+        {
+            add(unit->m_gid);
+            add(unit->m_pos);
+            add(unit->m_heading);
+            add(unit->m_currentHealth);
+            add(unit->m_resourcesCarried.second);
+        }
+    }
+    for (const auto& resource : world.m_resources)
+    {
+        add(resource.m_gid);
+        add(resource.m_amount);
+    }
+    for (const auto& satellite : world.m_satellites)
+    {
+        add(satellite.m_gid);
+        add(satellite.Position(world.m_satelliteTime));
+    }
+    return hash;
+}
+
+void Replay::WriteRecord(const World& world, uint64_t stateHash, std::vector<unsigned char>& record)
+{
+    record.clear();
+
+    uint32_t unitCount = 0;
+    for (const auto& player : world.m_players)
+    {
+        unitCount += static_cast<uint32_t>(player->m_units.size());
+    }
+    Append(record, unitCount);
+
+    for (const auto& player : world.m_players)
+    {
+        for (const auto& unit : player->m_units)
+        {
+            Append(record, static_cast<uint32_t>(unit->m_gid));
+            Append(record, static_cast<uint8_t>(unit->m_actionTooltip));
+            Append(record, static_cast<uint32_t>(unit->m_actionTargetGid));
+            Append(record, unit->m_heading);
+        }
+    }
+    Append(record, stateHash);
+}
+
+void Replay::PrintDivergence(size_t tick, const std::vector<unsigned char>& recorded, const std::vector<unsigned char>& replayed)
+{
+    const unsigned char* lhs = recorded.data();
+    const unsigned char* rhs = replayed.data();
+    auto recordedCount = Extract<uint32_t>(lhs);
+    auto replayedCount = Extract<uint32_t>(rhs);
+    if (recordedCount != replayedCount)
+    {
+        fmt::print(stderr, "Update {}: {} units were recorded, but {} units exist in the replay\n", tick, recordedCount, replayedCount);
+        return;
+    }
+
+    for (uint32_t i = 0; i < recordedCount; i++, lhs += UNIT_ACTION_SIZE, rhs += UNIT_ACTION_SIZE)
+    {
+        if (std::memcmp(lhs, rhs, UNIT_ACTION_SIZE) == 0)
+        {
+            continue;
+        }
+        const unsigned char* recordedAction = lhs;
+        const unsigned char* replayedAction = rhs;
+        auto gid = Extract<uint32_t>(recordedAction);
+        auto action = Extract<uint8_t>(recordedAction);
+        auto target = Extract<uint32_t>(recordedAction);
+        auto heading = Extract<float>(recordedAction);
+        auto replayedGid = Extract<uint32_t>(replayedAction);
+        auto replayedActionType = Extract<uint8_t>(replayedAction);
+        auto replayedTarget = Extract<uint32_t>(replayedAction);
+        auto replayedHeading = Extract<float>(replayedAction);
+        fmt::print(stderr, "Update {}: unit {} recorded (action {}, target {}, heading {}), replayed unit {} (action {}, target {}, heading {})\n",
+                   tick, gid, action, target, heading, replayedGid, replayedActionType, replayedTarget, replayedHeading);
+        return;
+    }
+
+    fmt::print(stderr, "Update {}: all actions are equal, but the state hash differs\n", tick);
+}
+
+int Replay::Play(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        fmt::print(stderr, "Could not open the replay file '{}'\n", path);
+        return EXIT_FAILURE;
+    }
+
+    std::array<unsigned char, HEADER_SIZE> headerBuffer{};
+    Header header;
+    if (!file.read(reinterpret_cast<char*>(headerBuffer.data()), headerBuffer.size()) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        || !DeserializeHeader(headerBuffer, header))
+    {
+        fmt::print(stderr, "'{}' is no replay file of version {}\n", path, VERSION);
+        return EXIT_FAILURE;
+    }
+    auto current = CurrentSettings(header.seed, header.timeStep, header.gameTimeLimit);
+    current.phasedUpdate = header.phasedUpdate;
+    current.randomStreams = header.randomStreams;
+    if (SerializeHeader(header) != SerializeHeader(current))
+    {
+        fmt::print(stderr, "The replay was recorded with other game settings (players, neutral units, satellites or difficulty options)\n");
+        return EXIT_FAILURE;
+    }
+
+    glob::game::UPDATE_TIME_STEP = header.timeStep;
+    glob::game::PHASED_UPDATE = header.phasedUpdate;
+    glob::game::RANDOM_STREAMS = header.randomStreams;
+
+    World world;
+    world.m_gameRng.useSeedInsteadOfSystemTime = true;
+    world.m_gameRng.seed = header.seed;
+    world.m_gameTimeLimit = header.gameTimeLimit;
+
+    world.OnStart();
+    world.m_gameRunning = true;
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    uint64_t stateHash = FNV_OFFSET_BASIS;
+    std::vector<unsigned char> recorded;
+    std::vector<unsigned char> replayed;
+    size_t tick = 0;
+    bool truncated = false;
+    for (;; ++tick)
+    {
+        uint32_t unitCount = 0;
+        if (!file.read(reinterpret_cast<char*>(&unitCount), sizeof(unitCount))) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        {
+            truncated = file.gcount() != 0; // The file may only end between two records
+            break;
+        }
+        recorded.resize(sizeof(unitCount) + unitCount * UNIT_ACTION_SIZE + sizeof(stateHash));
+        std::memcpy(recorded.data(), &unitCount, sizeof(unitCount));
+        if (!file.read(reinterpret_cast<char*>(recorded.data() + sizeof(unitCount)), static_cast<std::streamsize>(recorded.size() - sizeof(unitCount)))) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        {
+            truncated = true;
+            break;
+        }
+
+        world.Update(header.timeStep);
+        stateHash = HashState(world, stateHash);
+        WriteRecord(world, stateHash, replayed);
+
+        if (recorded != replayed)
+        {
+            PrintDivergence(tick, recorded, replayed);
+            fmt::print(stderr, "The replay diverged from the recording\n");
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+
+    fmt::print("Seed:      {}\n", header.seed);
+    fmt::print("Ticks:     {} ({:.0f} ticks/s)\n", tick, duration.count() > 0.0 ? static_cast<double>(tick) / duration.count() : 0.0);
+    fmt::print("Game time: {:.2f} s\n", world.m_gameTime);
+    fmt::print("State:     {:016x}\n", stateHash);
+    if (truncated)
+    {
+        fmt::print(stderr, "The recording is cut off, the record of update {} is incomplete\n", tick);
+        return EXIT_FAILURE;
+    }
+    fmt::print("The replay matches the recording\n");
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace oop::internal
@@ -0,0 +1,83 @@
+/// @file Replay.hpp
+/// @brief Records the actions of a match and plays them back to verify that the match is reproduced exactly
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace oop::internal
+{
+
+class World;
+
+/// @brief Replay files consist of a header with the seed and the settings followed by one record per update.
+///
+/// A record holds the action, the target global id and the heading of every unit after the update together with a
+/// rolling hash over the state of the world. Records are appended while the match runs, so long matches do not have to
+/// be kept in memory and a cut off file can still be played back till the last complete record.
+/// All values are written in the byte order of the machine.
+class Replay
+{
+  public:
+    /// @brief Default constructor
+    Replay() = delete;
+
+    /// @brief Appends the records of a match to a replay file
+    class Recorder
+    {
+      public:
+        /// @brief Creates the file and writes the header
+        /// @param[in] path Path of the file
+        /// @param[in] world Started world to record (the seed and the settings are taken from it)
+        Recorder(const std::string& path, const World& world);
+
+        /// @brief Checks whether the file could be created
+        [[nodiscard]] bool IsOpen() const;
+
+        /// @brief Appends the record of the last update
+        /// @param[in] world World after the update
+        void RecordTick(const World& world);
+
+        /// @brief Rolling hash over the states of all recorded updates
+        [[nodiscard]] uint64_t StateHash() const { return m_stateHash; }
+
+      private:
+        /// File the records get appended to
+        std::ofstream m_file;
+        /// Buffer for a single record
+        std::vector<unsigned char> m_record;
+        /// Rolling hash over the recorded states
+        uint64_t m_stateHash;
+    };
+
+    /// @brief Simulates the recorded match as fast as possible and compares every update with its record
+    /// @param[in] path Path of the replay file
+    /// @return Exit code of the application (failure if the match diverged from the recording or the recording is cut off)
+    static int Play(const std::string& path);
+
+  private:
+    /// @brief Combines the state of the world with the hash of the previous update
+    /// @param[in] world World after the update
+    /// @param[in] previous Hash of the previous update
+    static uint64_t HashState(const World& world, uint64_t previous);
+
+    /// @brief Creates the record of an update
+    /// @param[in] world World after the update
+    /// @param[in] stateHash Rolling state hash including this update
+    /// @param[out] record Bytes of the record
+    static void WriteRecord(const World& world, uint64_t stateHash, std::vector<unsigned char>& record);
+
+    /// @brief Prints the first unit whose recorded action differs from the replayed one
+    /// @param[in] tick Index of the update
+    /// @param[in] recorded Record from the file
+    /// @param[in] replayed Record of the replayed update
+    static void PrintDivergence(size_t tick, const std::vector<unsigned char>& recorded, const std::vector<unsigned char>& replayed);
+};
+
+} // namespace oop::internal
@@ -0,0 +1,213 @@
+#include "SimulationThread.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include "game/Settings.hpp"
+#include "game/World.hpp"
+#include "helper/Profiler.hpp"
+
+namespace oop::internal
+{
+
+SimulationThread::SimulationThread(World& world)
+    : m_world(world) {}
+
+SimulationThread::~SimulationThread()
+{
+    Stop();
+}
+
+void SimulationThread::Start()
+{
+    if (m_thread.joinable())
+    {
+        return;
+    }
+    {
+        std::scoped_lock lock(m_commandMutex);
+        m_stop = false;
+    }
+    m_thread = std::thread(&SimulationThread::Run, this);
+}
+
+void SimulationThread::Stop()
+{
+    if (!m_thread.joinable())
+    {
+        return;
+    }
+    {
+        std::scoped_lock lock(m_commandMutex);
+        m_stop = true;
+    }
+    m_wakeUp.notify_one();
+    m_thread.join();
+}
+
+uint64_t SimulationThread::Post(Command command)
+{
+    uint64_t number = 0;
+    {
+        std::scoped_lock lock(m_commandMutex);
+        m_commands.push_back(std::move(command));
+        number = ++m_commandsPosted;
+    }
+    m_wakeUp.notify_one();
+    return number;
+}
+
+void SimulationThread::SetGameTimeModifier(float gameTimeModifier)
+{
+    m_gameTimeModifier.store(gameTimeModifier, std::memory_order_relaxed);
+}
+
+void SimulationThread::SetCaptureScanLines(bool captureScanLines)
+{
+    if (m_captureScanLines.exchange(captureScanLines, std::memory_order_relaxed) != captureScanLines)
+    {
+        Post([](World& /* world */) {}); // Publishes a new render state also while the game is paused
+    }
+}
+
+bool SimulationThread::FetchRenderState()
+{
+    return m_renderStates.Fetch();
+}
+
+const RenderState& SimulationThread::GetRenderState() const
+{
+    return m_renderStates.ReadBuffer();
+}
+
+std::unique_lock<std::mutex> SimulationThread::TryLockWorld()
+{
+    return std::unique_lock<std::mutex>{ m_worldMutex, std::try_to_lock };
+}
+
+void SimulationThread::Run()
+{
+    using Clock = std::chrono::steady_clock;
+
+    auto lastTime = Clock::now();
+    float backlog = 0.0F; // Game time which still has to be simulated [s]
+
+    while (true)
+    {
+        {
+            std::scoped_lock lock(m_commandMutex);
+            if (m_stop)
+            {
+                break;
+            }
+            std::swap(m_commands, m_commandsToApply);
+        }
+
+        bool paused = false;
+        {
+            std::scoped_lock lock(m_worldMutex);
+            for (auto& command : m_commandsToApply)
+            {
+                command(m_world);
+                m_world.m_changedSinceUpdate = true;
+                m_commandsApplied++;
+                m_renderStateOutdated = true;
+            }
+            m_commandsToApply.clear();
+
+            const float timeStep = glob::game::UPDATE_TIME_STEP;
+            const float gameTimeModifier = m_gameTimeModifier.load(std::memory_order_relaxed);
+            const auto batchStart = Clock::now();
+            backlog += std::chrono::duration<float>(batchStart - lastTime).count() * gameTimeModifier;
+            backlog = std::min(backlog, std::max(MAX_LAG * gameTimeModifier, timeStep));
+            lastTime = batchStart;
+
+            paused = !m_world.m_gameRunning;
+            if (paused)
+            {
+                // A paused update only refreshes the scans, so it is needed once after the world changed
+                if (m_renderStateOutdated)
+                {
+                    Step(timeStep);
+                }
+                backlog = 0.0F;
+            }
+            else
+            {
+                const auto batchEnd = batchStart + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(MAX_BATCH_DURATION));
+                while (backlog > 0.0F && m_world.m_gameRunning && Clock::now() < batchEnd)
+                {
+                    Step(timeStep);
+                    backlog -= timeStep;
+                }
+                paused = !m_world.m_gameRunning;
+            }
+        }
+
+        // Capturing only pays off if the GUI took the last state. Before sleeping the newest state is always published
+        if (m_renderStateOutdated && (paused || !m_renderStates.HasUnfetched()))
+        {
+            PublishRenderState();
+        }
+
+        std::unique_lock lock(m_commandMutex);
+        if (paused)
+        {
+            m_wakeUp.wait(lock, [this]() { return m_stop || !m_commands.empty(); });
+            lastTime = Clock::now();
+        }
+        else if (backlog <= 0.0F)
+        {
+            const float gameTimeModifier = m_gameTimeModifier.load(std::memory_order_relaxed);
+            const auto timeTillNextUpdate = std::chrono::duration<float>(-backlog / gameTimeModifier);
+            m_wakeUp.wait_for(lock, timeTillNextUpdate, [this]() { return m_stop || !m_commands.empty(); });
+        }
+    }
+}
+
+void SimulationThread::Step(float timeStep)
+{
+    m_world.Update(timeStep);
+    m_updates++;
+    if (m_world.m_attackOccurred)
+    {
+        m_attacks++;
+    }
+    m_renderStateOutdated = true;
+}
+
+void SimulationThread::PublishRenderState()
+{
+    if constexpr (Profiler::ENABLED)
+    {
+        Profiler::ForEachNewEvent(m_profilerCursor, [this](const Profiler::Event& event) {
+            auto& total = m_profilerTotals[event.name];
+            total.name = event.name;
+            total.type = event.type;
+            total.sum += static_cast<double>(event.value);
+            total.samples++;
+        });
+    }
+
+    auto& state = m_renderStates.WriteBuffer();
+    {
+        // The overlays of the GUI compute the lazy scans of the units while holding the lock, which the capture reads
+        std::scoped_lock lock(m_worldMutex);
+        state.Capture(m_world, m_captureScanLines.load(std::memory_order_relaxed));
+    }
+    state.timeStep = glob::game::UPDATE_TIME_STEP;
+    state.updates = m_updates;
+    state.attacks = m_attacks;
+    state.commandsApplied = m_commandsApplied;
+    state.profilerTotals.clear();
+    for (const auto& [name, total] : m_profilerTotals)
+    {
+        state.profilerTotals.push_back(total);
+    }
+
+    m_renderStates.Publish();
+    m_renderStateOutdated = false;
+}
+
+} // namespace oop::internal
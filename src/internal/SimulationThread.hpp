@@ -0,0 +1,163 @@
+/// @file SimulationThread.hpp
+/// @brief Runs the game logic of the GUI on its own thread
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "game/RenderState.hpp"
+#include "helper/TripleBuffer.hpp"
+
+namespace oop::internal
+{
+
+class World;
+
+/// @brief Updates a world with fixed time steps in the pace of the wall clock times the game time modifier.
+///
+/// Only the simulation thread touches the world. The GUI changes it by posting commands, which are applied between two
+/// updates, and draws the render states the thread publishes through a triple buffer. So a slow frame never delays the
+/// game and a fast game never delays a frame. If the updates can not keep up with the game speed, the game runs slower
+/// instead of piling up updates. While the game is paused the thread sleeps till the next command.
+class SimulationThread
+{
+  public:
+    /// @brief Change of the world, which is applied on the simulation thread
+    using Command = std::function<void(World&)>;
+
+    /// @brief Constructor
+    /// @param[in] world World to simulate (must not be accessed by other threads while the simulation runs)
+    explicit SimulationThread(World& world);
+    /// @brief Destructor, which stops the thread
+    ~SimulationThread();
+    /// @brief Copy constructor
+    SimulationThread(const SimulationThread&) = delete;
+    /// @brief Move constructor
+    SimulationThread(SimulationThread&&) = delete;
+    /// @brief Copy assignment operator
+    SimulationThread& operator=(const SimulationThread&) = delete;
+    /// @brief Move assignment operator
+    SimulationThread& operator=(SimulationThread&&) = delete;
+
+    /// @brief Starts the thread
+    void Start();
+
+    /// @brief Stops the thread after the current update and waits for it
+    void Stop();
+
+    /// @brief Applies the command to the world before the next update
+    /// @param[in] command Command to apply
+    /// @return Number of the command. It is applied once RenderState::commandsApplied reaches the number
+    uint64_t Post(Command command);
+
+    /// @brief Sets the multiplicator for the game time
+    /// @param[in] gameTimeModifier Game time per wall clock time
+    void SetGameTimeModifier(float gameTimeModifier);
+
+    /// @brief Sets whether the render states should contain the scan lines of the units
+    /// @param[in] captureScanLines Flag whether to capture the scan lines
+    void SetCaptureScanLines(bool captureScanLines);
+
+    /// @brief Takes over the newest render state the thread published (GUI thread)
+    /// @return True if there was a new one
+    bool FetchRenderState();
+
+    /// @brief Render state fetched last (GUI thread)
+    [[nodiscard]] const RenderState& GetRenderState() const;
+
+    /// @brief Locks the world if the thread is not updating it right now, e.g. to call code of the teams on it
+    /// @return Lock which owns the world if the locking succeeded
+    std::unique_lock<std::mutex> TryLockWorld();
+
+  private:
+    /// Wall clock time [s] after which a batch of updates is interrupted to apply commands and publish the state
+    static constexpr float MAX_BATCH_DURATION = 1.0F / 60.0F;
+
+    /// Wall clock time [s] the game may fall behind. Game time beyond is dropped, so the game slows down
+    static constexpr float MAX_LAG = 0.1F;
+
+    /// @brief Compares string literals by their content
+    struct NameLess
+    {
+        /// @brief Less comparison operator
+        bool operator()(const char* lhs, const char* rhs) const { return std::strcmp(lhs, rhs) < 0; }
+    };
+
+    /// @brief Loop of the thread
+    void Run();
+
+    /// @brief Updates the world by one time step
+    /// @param[in] timeStep Time step [s]
+    void Step(float timeStep);
+
+    /// @brief Captures the world into the write buffer and publishes it
+    void PublishRenderState();
+
+    /// World which gets simulated
+    World& m_world;
+
+    /// The simulation thread
+    std::thread m_thread;
+
+    /// Held by the simulation thread while it applies commands, updates or captures the world
+    std::mutex m_worldMutex;
+
+    /// Guards the posted commands and the stop flag
+    std::mutex m_commandMutex;
+
+    /// Wakes the thread up when a command is posted or it should stop
+    std::condition_variable m_wakeUp;
+
+    /// Commands posted but not applied yet
+    std::vector<Command> m_commands;
+
+    /// Amount of commands posted
+    uint64_t m_commandsPosted = 0;
+
+    /// Flag whether the thread should stop
+    bool m_stop = false;
+
+    /// Game time per wall clock time
+    std::atomic<float> m_gameTimeModifier{ 1.0F };
+
+    /// Flag whether the render states should contain the scan lines
+    std::atomic<bool> m_captureScanLines{ false };
+
+    /// Render states passed from the simulation thread to the GUI
+    TripleBuffer<RenderState> m_renderStates;
+
+    // ------------------------------------- Only used by the simulation thread -------------------------------------
+
+    /// Commands which get applied right now
+    std::vector<Command> m_commandsToApply;
+
+    /// Amount of commands applied
+    uint64_t m_commandsApplied = 0;
+
+    /// Amount of updates performed
+    uint64_t m_updates = 0;
+
+    /// Amount of updates in which an attack occurred
+    uint64_t m_attacks = 0;
+
+    /// Flag whether the world changed since the last published render state
+    bool m_renderStateOutdated = true;
+
+    /// Amount of profiler events of the thread already summed up
+    uint64_t m_profilerCursor = 0;
+
+    /// Sums of the profiler zones and counters of the thread
+    std::map<const char*, RenderState::ProfilerTotal, NameLess> m_profilerTotals;
+};
+
+} // namespace oop::internal
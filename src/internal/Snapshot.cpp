@@ -0,0 +1,494 @@
+#include "Snapshot.hpp"
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <spdlog/spdlog.h>
+
+#include "game/World.hpp"
+#include "game/units/Unit.hpp"
+#include "game/neutral/NeutralPlayer.hpp"
+#include "game/neutral/units/Virus.hpp"
+#include "helper/MappedFile.hpp"
+
+namespace oop::internal
+{
+
+namespace
+{
+
+/// First bytes of every snapshot file
+constexpr std::array<char, 8> MAGIC = { 'O', 'O', 'P', 'S', 'N', 'A', 'P', '\0' };
+
+/// Version of the file format
+constexpr uint32_t VERSION = 2;
+
+/// Class a unit gets restored as
+enum UnitKind : uint8_t
+{
+    UnitKind_Headquarters, ///< Headquarters of the team
+    UnitKind_Robot,        ///< Robot of the team
+    UnitKind_Virus,        ///< Virus of the neutral player
+};
+
+static_assert(std::is_trivially_copyable_v<std::default_random_engine>, "The engine state gets copied bytewise");
+static_assert(sizeof(std::default_random_engine) <= 16, "The engine state does not fit into the record");
+
+/// State of a random number generator
+struct RngRecord
+{
+    uint64_t seed;                        ///< Seed of the generator
+    std::array<unsigned char, 16> engine; ///< Bytes of the std::default_random_engine
+    uint8_t useSeedInsteadOfSystemTime;   ///< Flag whether the seed is used instead of the system time
+    std::array<uint8_t, 7> padding;       ///< Explicit padding
+};
+
+/// Start of the file with the state of the world and the amount of the following records
+struct Header
+{
+    std::array<char, 8> magic;     ///< MAGIC
+    uint32_t version;              ///< VERSION
+    uint32_t engineSize;           ///< sizeof(std::default_random_engine) of the build which saved the file
+    uint64_t currentGid;           ///< Global id which gets assigned next
+    uint64_t tick;                 ///< Amount of updates performed
+    uint64_t winningPlayerGid;     ///< Global id of the player who won the round (0 if nobody won)
+    float gameTime;                ///< Time of the match in [s]
+    int32_t gameTimeLimit;         ///< Game time limit in [s]
+    int32_t gameFinished;          ///< Flag whether the game is finished
+    uint32_t playerCount;          ///< Amount of player records (including the neutral player)
+    uint32_t unitCount;            ///< Amount of unit records
+    uint32_t resourceCount;        ///< Amount of resource records
+    uint32_t satelliteCount;       ///< Amount of satellite records
+    float satelliteTime;           ///< Game time the satellites are at in [s]
+    Color winningPlayerColor;      ///< Color of the player who won the round
+    std::array<RngRecord, 3> rngs; ///< Game, user and paused user random number generator
+};
+
+/// State of a player
+struct PlayerRecord
+{
+    uint64_t gid;                                       ///< Global id
+    uint64_t unitsLost;                                 ///< Amount of units which got destroyed
+    std::array<uint64_t, ResourceType_COUNT> resources; ///< Currently available resources
+    std::array<uint64_t, ResourceType_COUNT> collected; ///< Total collected resources
+    Color color;                                        ///< Color of the units
+    std::array<float, 2> hqPosition;                    ///< Position of the headquarters
+    int32_t itemsCloseToPlayer;                         ///< Amount of resources spawned close to the headquarters
+    uint8_t isAlive;                                    ///< Whether the player is still alive
+    std::array<uint8_t, 3> padding;                     ///< Explicit padding
+};
+
+/// State of a unit (the records of a player are in the update order)
+struct UnitRecord
+{
+    uint64_t gid;                                  ///< Global id
+    uint64_t actionTargetGid;                      ///< Target global id of the action
+    uint64_t carriedAmount;                        ///< Amount of resources carried
+    uint64_t virusTargetGid;                       ///< Global id of the unit a virus attacks
+    double clockOffset;                            ///< Clock offset of the distance measurements
+    std::array<float, 2> position;                 ///< Position
+    float heading;                                 ///< Heading in [rad]
+    float headingBias;                             ///< Heading bias in [rad]
+    float health;                                  ///< Current health
+    float attackBlockTime;                         ///< Time the unit is prevented from attacking
+    std::array<float, 2> lastAttackedUnitPosition; ///< Position of the last attacked unit
+    float speed;                                   ///< Speed attribute
+    float maxHealth;                               ///< Maximum health attribute
+    float scanRange;                               ///< Scan range attribute
+    float collectRange;                            ///< Collect range attribute
+    float attackRange;                             ///< Attack range attribute
+    int32_t containerSize;                         ///< Container size attribute
+    int32_t attackPower;                           ///< Attack power attribute
+    float virusFleeTime;                           ///< Time a virus keeps fleeing
+    std::array<float, 2> virusTargetPosition;      ///< Position a virus explores to
+    uint32_t playerIndex;                          ///< Index of the player record the unit belongs to
+    uint8_t kind;                                  ///< UnitKind
+    uint8_t action;                                ///< Planned action
+    uint8_t actionTooltip;                         ///< Planned action shown in the tooltip
+    uint8_t carriedType;                           ///< Type of resources carried
+    uint8_t virusState;                            ///< State of a virus
+    std::array<uint8_t, 7> padding;                ///< Explicit padding
+};
+
+/// State of a resource
+struct ResourceRecord
+{
+    uint64_t gid;                   ///< Global id
+    std::array<float, 2> position;  ///< Position
+    float heading;                  ///< Heading in [rad]
+    int32_t amount;                 ///< Amount of resources available
+    uint8_t type;                   ///< ResourceType
+    std::array<uint8_t, 7> padding; ///< Explicit padding
+};
+
+/// State of a satellite
+struct SatelliteRecord
+{
+    uint64_t gid;                       ///< Global id
+    std::array<float, 2> spawnPosition; ///< Position where the satellite spawned
+    float spawnTime;                    ///< Game time of the spawn in [s]
+    float speed;                        ///< Speed
+    float faultySpeed;                  ///< Speed of the wrong position of a faulty satellite
+    float heading;                      ///< Heading in [rad]
+    uint8_t isFaulty;                   ///< Whether the satellite transmits a wrong position
+    std::array<uint8_t, 7> padding;     ///< Explicit padding
+};
+
+// The sizes are part of the file format, so the records must not contain implicit padding
+static_assert(sizeof(RngRecord) == 32);
+static_assert(sizeof(Header) == 184);
+static_assert(sizeof(PlayerRecord) == 96);
+static_assert(sizeof(UnitRecord) == 128);
+static_assert(sizeof(ResourceRecord) == 32);
+static_assert(sizeof(SatelliteRecord) == 40);
+
+template<typename T>
+void Write(std::ofstream& file, const T& record)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    file.write(reinterpret_cast<const char*>(&record), sizeof(T)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+/// Copies the record at the index out of the mapped records
+template<typename T>
+T Read(const unsigned char* records, size_t index)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    T record{};
+    std::memcpy(&record, records + index * sizeof(T), sizeof(T));
+    return record;
+}
+
+} // namespace
+
+bool Snapshot::Save(const World& world, const std::string& path)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        spdlog::error("Could not open the snapshot file '{}'", path);
+        return false;
+    }
+
+    auto rngRecord = [](const RandomNumberGenerator& rng) {
+        RngRecord record{};
+        record.seed = rng.seed;
+        std::memcpy(record.engine.data(), &rng.random_engine, sizeof(rng.random_engine));
+        record.useSeedInsteadOfSystemTime = rng.useSeedInsteadOfSystemTime;
+        return record;
+    };
+
+    Header header{};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.engineSize = sizeof(std::default_random_engine);
+    header.currentGid = world.m_currentGid;
+    header.tick = world.m_tick;
+    header.winningPlayerGid = world.m_winningPlayerGid;
+    header.gameTime = world.m_gameTime;
+    header.gameTimeLimit = world.m_gameTimeLimit;
+    header.gameFinished = world.m_gameFinished;
+    header.playerCount = static_cast<uint32_t>(world.m_players.size());
+    for (const auto& player : world.m_players)
+    {
+        header.unitCount += static_cast<uint32_t>(player->m_units.size());
+    }
+    header.resourceCount = static_cast<uint32_t>(world.m_resources.size());
+    header.satelliteCount = static_cast<uint32_t>(world.m_satellites.size());
+    header.satelliteTime = world.m_satelliteTime;
+    header.winningPlayerColor = world.m_winningPlayerColor;
+    header.rngs = { rngRecord(world.m_gameRng), rngRecord(world.m_userRng), rngRecord(world.m_userRngPause) };
+    Write(file, header);
+
+    for (size_t p = 0; p < world.m_players.size(); p++)
+    {
+        const auto& player = world.m_players.at(p);
+        PlayerRecord record{};
+        record.gid = player->m_gid;
+        record.unitsLost = player->m_unitsLost;
+        for (size_t t = 0; t < ResourceType_COUNT; t++)
+        {
+            record.resources.at(t) = player->m_resources.at(t);
+            record.collected.at(t) = player->m_collectedResourcesTotal.at(t);
+        }
+        record.color = player->m_color;
+        if (p != 0) // The neutral player has no headquarters
+        {
+            record.hqPosition = { player->m_hqPosition.x(), player->m_hqPosition.y() };
+            record.itemsCloseToPlayer = world.m_itemsCloseToPlayer.at(p - 1);
+        }
+        record.isAlive = player->m_isAlive;
+        Write(file, record);
+    }
+
+    for (size_t p = 0; p < world.m_players.size(); p++)
+    {
+        for (const auto& unit : world.m_players.at(p)->m_units)
+        {
+            UnitRecord record{};
+            record.gid = unit->m_gid;
+            record.actionTargetGid = unit->m_actionTargetGid;
+            record.carriedAmount = unit->m_resourcesCarried.second;
+            record.clockOffset = unit->m_clockOffset;
+            record.position = { unit->m_pos.x(), unit->m_pos.y() };
+            record.heading = unit->m_heading;
+            record.headingBias = unit->m_headingBias;
+            record.health = unit->m_currentHealth;
+            record.attackBlockTime = unit->m_attackBlockTime;
+            record.lastAttackedUnitPosition = { unit->m_lastAttackedUnitPosition.x(), unit->m_lastAttackedUnitPosition.y() };
+            record.speed = unit->m_speed;
+            record.maxHealth = unit->m_maxHealth;
+            record.scanRange = unit->m_scanRange;
+            record.collectRange = unit->m_collectRange;
+            record.attackRange = unit->m_attackRange;
+            record.containerSize = unit->m_resourceContainerSize;
+            record.attackPower = unit->m_attackPower;
+            record.playerIndex = static_cast<uint32_t>(p);
+            record.kind = unit->IsHeadquarters() ? UnitKind_Headquarters : UnitKind_Robot;
+            record.action = unit->m_action;
+            record.actionTooltip = unit->m_actionTooltip;
+            record.carriedType = unit->m_resourcesCarried.first;
+            if (const auto* virus = dynamic_cast<const Virus*>(unit.get()))
+            {
+                record.kind = UnitKind_Virus;
+                record.virusTargetGid = virus->m_targetGid;
+                record.virusFleeTime = virus->m_fleeTime;
+                record.virusTargetPosition = { virus->m_targetPos.x(), virus->m_targetPos.y() };
+                record.virusState = static_cast<uint8_t>(virus->state);
+            }
+            Write(file, record);
+        }
+    }
+
+    for (const auto& resource : world.m_resources)
+    {
+        ResourceRecord record{};
+        record.gid = resource.m_gid;
+        record.position = { resource.m_pos.x(), resource.m_pos.y() };
+        record.heading = resource.m_heading;
+        record.amount = resource.m_amount;
+        record.type = resource.m_type;
+        Write(file, record);
+    }
+
+    for (const auto& satellite : world.m_satellites)
+    {
+        SatelliteRecord record{};
+        record.gid = satellite.m_gid;
+        record.spawnPosition = { satellite.m_spawnPos.x(), satellite.m_spawnPos.y() };
+        record.spawnTime = satellite.m_spawnTime;
+        record.speed = satellite.m_speed;
+        record.faultySpeed = satellite.m_faultySpeed;
+        record.heading = satellite.m_heading;
+        record.isFaulty = satellite.m_isFaulty;
+        Write(file, record);
+    }
+
+    if (!file)
+    {
+        spdlog::error("Could not write the snapshot file '{}'", path);
+        return false;
+    }
+    return true;
+}
+
+bool Snapshot::Load(World& world, const std::string& path)
+{
+    MappedFile file(path);
+    if (!file.IsOpen())
+    {
+        spdlog::error("Could not open the snapshot file '{}'", path);
+        return false;
+    }
+
+    Header header{};
+    if (file.size() >= sizeof(Header))
+    {
+        header = Read<Header>(file.data(), 0);
+    }
+    if (header.magic != MAGIC || header.version != VERSION)
+    {
+        spdlog::error("'{}' is no snapshot file of version {}", path, VERSION);
+        return false;
+    }
+    if (header.engineSize != sizeof(std::default_random_engine))
+    {
+        spdlog::error("The snapshot '{}' was saved with another random number engine", path);
+        return false;
+    }
+
+    const unsigned char* players = file.data() + sizeof(Header);
+    const unsigned char* units = players + size_t{ header.playerCount } * sizeof(PlayerRecord);
+    const unsigned char* resources = units + size_t{ header.unitCount } * sizeof(UnitRecord);
+    const unsigned char* satellites = resources + size_t{ header.resourceCount } * sizeof(ResourceRecord);
+    const unsigned char* end = satellites + size_t{ header.satelliteCount } * sizeof(SatelliteRecord);
+    if (static_cast<size_t>(end - file.data()) != file.size() || header.playerCount == 0)
+    {
+        spdlog::error("The snapshot '{}' is incomplete", path);
+        return false;
+    }
+
+    // Check the records before the world gets changed
+    for (size_t i = 0; i < header.unitCount; i++)
+    {
+        auto record = Read<UnitRecord>(units, i);
+        if (record.playerIndex >= header.playerCount || (record.playerIndex == 0) != (record.kind == UnitKind_Virus)
+            || record.kind > UnitKind_Virus || record.carriedType > ResourceType_COUNT)
+        {
+            spdlog::error("The snapshot '{}' contains an invalid unit", path);
+            return false;
+        }
+    }
+    for (size_t i = 0; i < header.resourceCount; i++)
+    {
+        if (Read<ResourceRecord>(resources, i).type >= ResourceType_COUNT)
+        {
+            spdlog::error("The snapshot '{}' contains an invalid resource", path);
+            return false;
+        }
+    }
+
+    World::Scope scope(world);
+
+    world.m_gidIndex.clear();
+    world.m_players.clear();
+    world.m_resources.clear();
+    world.m_satellites.clear();
+    world.m_itemsCloseToPlayer.clear();
+
+    // The constructors of the players spawn their starting units, which get replaced by the units of the snapshot
+    world.m_players.reserve(header.playerCount);
+    for (size_t p = 0; p < header.playerCount; p++)
+    {
+        auto record = Read<PlayerRecord>(players, p);
+        if (p == 0)
+        {
+            world.m_players.push_back(std::make_shared<NeutralPlayer>(record.color));
+        }
+        else
+        {
+            world.m_players.push_back(World::CreatePlayer(p - 1, { record.hqPosition.at(0), record.hqPosition.at(1) }, record.color));
+            world.m_itemsCloseToPlayer.push_back(record.itemsCloseToPlayer);
+        }
+    }
+
+    std::vector<std::vector<UnitPtr>> playerUnits(header.playerCount);
+    for (size_t i = 0; i < header.unitCount; i++)
+    {
+        auto record = Read<UnitRecord>(units, i);
+        auto* parent = world.m_players.at(record.playerIndex).get();
+        const Eigen::Vector2f position{ record.position.at(0), record.position.at(1) };
+
+        UnitPtr unit;
+        switch (record.kind)
+        {
+        case UnitKind_Headquarters:
+            unit = world.CreateHeadquarters(record.playerIndex - 1, parent, record.gid, position, record.heading);
+            break;
+        case UnitKind_Robot:
+            unit = world.CreateRobot(record.playerIndex - 1, parent, position, record.heading);
+            break;
+        default:
+        {
+            auto virus = world.m_unitPool.Create<Virus>(parent, position, record.heading);
+            virus->state = static_cast<Virus::State>(record.virusState);
+            virus->m_fleeTime = record.virusFleeTime;
+            virus->m_targetPos = { record.virusTargetPosition.at(0), record.virusTargetPosition.at(1) };
+            virus->m_targetGid = record.virusTargetGid;
+            unit = std::move(virus);
+            break;
+        }
+        }
+
+        unit->m_gid = record.gid;
+        unit->m_action = static_cast<Unit::Action>(record.action);
+        unit->m_actionTooltip = static_cast<Unit::Action>(record.actionTooltip);
+        unit->m_actionTargetGid = record.actionTargetGid;
+        unit->m_pos = position;
+        unit->AssignHeading(record.heading);
+        unit->m_headingBias = record.headingBias;
+        unit->m_currentHealth = record.health;
+        unit->m_attackBlockTime = record.attackBlockTime;
+        unit->m_lastAttackedUnitPosition = { record.lastAttackedUnitPosition.at(0), record.lastAttackedUnitPosition.at(1) };
+        unit->m_resourcesCarried = { static_cast<ResourceType>(record.carriedType), record.carriedAmount };
+        unit->m_clockOffset = record.clockOffset;
+        unit->m_speed = record.speed;
+        unit->m_maxHealth = record.maxHealth;
+        unit->m_scanRange = record.scanRange;
+        unit->m_collectRange = record.collectRange;
+        unit->m_resourceContainerSize = record.containerSize;
+        unit->m_attackPower = record.attackPower;
+        unit->m_attackRange = record.attackRange;
+        playerUnits.at(record.playerIndex).push_back(std::move(unit));
+    }
+
+    for (size_t p = 0; p < header.playerCount; p++)
+    {
+        auto record = Read<PlayerRecord>(players, p);
+        auto& player = *world.m_players.at(p);
+        player.m_gid = record.gid;
+        player.m_unitsLost = record.unitsLost;
+        for (size_t t = 0; t < ResourceType_COUNT; t++)
+        {
+            player.m_resources.at(t) = record.resources.at(t);
+            player.m_collectedResourcesTotal.at(t) = record.collected.at(t);
+        }
+        player.m_isAlive = record.isAlive;
+        player.m_units = std::move(playerUnits.at(p));
+    }
+
+    world.m_resources.reserve(header.resourceCount);
+    for (size_t i = 0; i < header.resourceCount; i++)
+    {
+        auto record = Read<ResourceRecord>(resources, i);
+        world.m_resources.Emplace(static_cast<ResourceType>(record.type), record.amount,
+                                  Eigen::Vector2f{ record.position.at(0), record.position.at(1) }, record.heading);
+        world.m_resources.back().m_gid = record.gid;
+    }
+
+    world.m_satellites.reserve(header.satelliteCount);
+    for (size_t i = 0; i < header.satelliteCount; i++)
+    {
+        auto record = Read<SatelliteRecord>(satellites, i);
+        world.m_satellites.Emplace(Eigen::Vector2f{ record.spawnPosition.at(0), record.spawnPosition.at(1) }, record.heading, record.spawnTime);
+        auto& satellite = world.m_satellites.back();
+        satellite.m_gid = record.gid;
+        satellite.m_speed = record.speed;
+        satellite.m_faultySpeed = record.faultySpeed;
+        satellite.m_isFaulty = record.isFaulty;
+    }
+
+    // The constructors above draw random numbers and global ids, so the generators and the counter are restored last
+    auto restoreRng = [](const RngRecord& record, RandomNumberGenerator& rng) {
+        rng.seed = record.seed;
+        rng.useSeedInsteadOfSystemTime = record.useSeedInsteadOfSystemTime;
+        std::memcpy(&rng.random_engine, record.engine.data(), sizeof(rng.random_engine));
+    };
+    restoreRng(header.rngs.at(0), world.m_gameRng);
+    restoreRng(header.rngs.at(1), world.m_userRng);
+    restoreRng(header.rngs.at(2), world.m_userRngPause);
+
+    world.m_currentGid = header.currentGid;
+    world.m_tick = header.tick;
+    world.m_winningPlayerGid = header.winningPlayerGid;
+    world.m_gameTime = header.gameTime;
+    world.m_satelliteTime = header.satelliteTime;
+    world.m_gameTimeLimit = header.gameTimeLimit;
+    world.m_gameFinished = header.gameFinished;
+    world.m_winningPlayerColor = header.winningPlayerColor;
+    world.m_gameRunning = false;
+    world.m_attackOccurred = false;
+    world.m_changedSinceUpdate = true;
+    world.m_neighbourListsOutdated = true;
+
+    world.RebuildGidIndex();
+    world.RebuildResourceGrid();
+
+    return true;
+}
+
+} // namespace oop::internal
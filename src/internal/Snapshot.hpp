@@ -0,0 +1,43 @@
+/// @file Snapshot.hpp
+/// @brief Saves the complete state of a world to a binary file and restores it again
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <string>
+
+namespace oop::internal
+{
+
+class World;
+
+/// @brief Snapshot files consist of a header followed by fixed size records of the players, units, resources and satellites.
+///
+/// The records have a fixed layout without implicit padding, so a restore maps the file and copies the records
+/// directly into the game objects. The file contains the state of the random number generators and the global id
+/// counter, so a restored match continues exactly like the original one.
+/// All values are written in the byte order of the machine.
+///
+/// Members which the teams add to their own Player, Robot and Headquarters classes are not part of the snapshot.
+/// Robots are restored as the Robot class of their team.
+class Snapshot
+{
+  public:
+    /// @brief Default constructor
+    Snapshot() = delete;
+
+    /// @brief Writes the state of the world to a file
+    /// @param[in] world World to save
+    /// @param[in] path Path of the file
+    /// @return True if the file could be written
+    static bool Save(const World& world, const std::string& path);
+
+    /// @brief Replaces the state of the world with the one of the file. The restored world is paused
+    /// @param[in, out] world World to restore into (unchanged if the file can not be read)
+    /// @param[in] path Path of the file
+    /// @return True if the snapshot could be restored
+    static bool Load(World& world, const std::string& path);
+};
+
+} // namespace oop::internal
@@ -0,0 +1,394 @@
+#include "Tournament.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <fmt/core.h>
+
+#include "game/World.hpp"
+#include "game/Settings.hpp"
+
+namespace oop::internal
+{
+
+namespace
+{
+
+/// @brief Quotes the text if it contains characters with a special meaning in CSV
+std::string CsvEscape(const std::string& text)
+{
+    if (text.find_first_of(",\"\n") == std::string::npos)
+    {
+        return text;
+    }
+    std::string escaped = "\"";
+    for (char c : text)
+    {
+        escaped += c;
+        if (c == '"')
+        {
+            escaped += '"';
+        }
+    }
+    return escaped + '"';
+}
+
+/// @brief Escapes the text to be used as JSON string (without the surrounding quotes)
+std::string JsonEscape(const std::string& text)
+{
+    std::string escaped;
+    for (char c : text)
+    {
+        switch (c)
+        {
+        case '"':
+            escaped += "\\\"";
+            break;
+        case '\\':
+            escaped += "\\\\";
+            break;
+        case '\n':
+            escaped += "\\n";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                escaped += fmt::format("\\u{:04x}", static_cast<int>(c));
+            }
+            else
+            {
+                escaped += c;
+            }
+        }
+    }
+    return escaped;
+}
+
+/// @brief Sum of the collected resources of all types
+size_t Total(const std::array<size_t, ResourceType_COUNT>& collected)
+{
+    size_t sum = 0;
+    for (auto amount : collected)
+    {
+        sum += amount;
+    }
+    return sum;
+}
+
+} // namespace
+
+int Tournament::Run(uint64_t firstSeed, size_t seedCount, size_t threadCount, size_t ticks, float timeStep,
+                    const std::string& csvPath, const std::string& jsonPath)
+{
+    glob::game::UPDATE_TIME_STEP = timeStep;
+
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    threadCount = std::min(threadCount, seedCount);
+
+    std::vector<MatchResult> results(seedCount);
+    std::atomic<size_t> nextMatch = 0;
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+
+    // Every worker takes the next seed as soon as its match is done, so long and short matches balance out.
+    // The matches do not share any mutable state and each one writes only into its own result.
+    auto worker = [&]() {
+        try
+        {
+            for (size_t i = nextMatch++; i < seedCount; i = nextMatch++)
+            {
+                results[i] = PlayMatch(firstSeed + i, ticks, timeStep);
+            }
+        }
+        catch (...)
+        {
+            std::scoped_lock lock(exceptionMutex);
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+            nextMatch = seedCount; // Let the other workers stop after their current match
+        }
+    };
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    for (size_t t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+
+    if (exception)
+    {
+        try
+        {
+            std::rethrow_exception(exception);
+        }
+        catch (const std::exception& e)
+        {
+            fmt::print(stderr, "A match failed: {}\n", e.what());
+        }
+        catch (...)
+        {
+            fmt::print(stderr, "A match failed with an unknown error\n");
+        }
+        return EXIT_FAILURE;
+    }
+
+    size_t totalTicks = 0;
+    for (const auto& result : results)
+    {
+        totalTicks += result.ticks;
+    }
+
+    auto aggregate = Accumulate(results);
+
+    fmt::print("Seeds:     {} - {} ({} matches on {} threads)\n", firstSeed, firstSeed + seedCount - 1, seedCount, threadCount);
+    fmt::print("Duration:  {:.2f} s ({:.2f} matches/s, {:.0f} ticks/s)\n", duration.count(),
+               duration.count() > 0.0 ? static_cast<double>(seedCount) / duration.count() : 0.0,
+               duration.count() > 0.0 ? static_cast<double>(totalTicks) / duration.count() : 0.0);
+    fmt::print("Finished:  {} / {} ({} without winner)\n", aggregate.finished, aggregate.matches, aggregate.draws);
+    fmt::print("Game time: mean {:.2f} s, min {:.2f} s, max {:.2f} s\n", aggregate.gameTimeMean, aggregate.gameTimeMin, aggregate.gameTimeMax);
+    for (size_t p = 0; p < aggregate.players.size(); p++)
+    {
+        const auto& player = aggregate.players.at(p);
+        fmt::print("Player {} '{}': {} wins, {} survived, collected mean {:.1f} (min {}, max {}) [{:.1f}, {:.1f}, {:.1f}], units lost mean {:.1f}\n",
+                   p + 1, player.name, player.wins, player.survived, player.totalMean, player.totalMin, player.totalMax,
+                   player.collectedMean.at(ResourceType_Capacitor),
+                   player.collectedMean.at(ResourceType_Coil),
+                   player.collectedMean.at(ResourceType_Resistor),
+                   player.unitsLostMean);
+    }
+
+    bool success = true;
+    if (!csvPath.empty())
+    {
+        success &= WriteCsv(csvPath, results, aggregate);
+    }
+    if (!jsonPath.empty())
+    {
+        success &= WriteJson(jsonPath, results, aggregate);
+    }
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+Tournament::MatchResult Tournament::PlayMatch(uint64_t seed, size_t ticks, float timeStep)
+{
+    World world;
+    world.m_gameRng.useSeedInsteadOfSystemTime = true;
+    world.m_gameRng.seed = seed;
+
+    world.OnStart();
+    world.m_gameRunning = true;
+
+    MatchResult result;
+    result.seed = seed;
+    for (; result.ticks < ticks && !world.m_gameFinished; ++result.ticks)
+    {
+        world.Update(timeStep);
+    }
+    result.gameTime = world.m_gameTime;
+    result.finished = world.m_gameFinished;
+    result.winnerGid = world.m_winningPlayerGid;
+
+    for (const auto& player : world.m_players)
+    {
+        if (!player->m_gid) // Neutral player
+        {
+            continue;
+        }
+        result.players.push_back({ player->m_gid, player->GetName(), player->m_isAlive,
+                                   player->m_collectedResourcesTotal, player->m_unitsLost });
+    }
+
+    return result;
+}
+
+Tournament::Aggregate Tournament::Accumulate(const std::vector<MatchResult>& results)
+{
+    Aggregate aggregate;
+    aggregate.matches = results.size();
+    if (results.empty())
+    {
+        return aggregate;
+    }
+
+    aggregate.gameTimeMin = results.front().gameTime;
+    aggregate.gameTimeMax = results.front().gameTime;
+    for (const auto& result : results)
+    {
+        aggregate.finished += result.finished;
+        aggregate.draws += result.finished && !result.winnerGid;
+        aggregate.gameTimeMean += static_cast<double>(result.gameTime);
+        aggregate.gameTimeMin = std::min(aggregate.gameTimeMin, result.gameTime);
+        aggregate.gameTimeMax = std::max(aggregate.gameTimeMax, result.gameTime);
+
+        if (aggregate.players.size() < result.players.size())
+        {
+            aggregate.players.resize(result.players.size());
+        }
+        for (size_t p = 0; p < result.players.size(); p++)
+        {
+            const auto& player = result.players.at(p);
+            auto& playerAggregate = aggregate.players.at(p);
+
+            size_t total = Total(player.collected);
+            if (playerAggregate.matches == 0) // First match of the player (the name can be empty)
+            {
+                playerAggregate.name = player.name;
+                playerAggregate.totalMin = total;
+                playerAggregate.totalMax = total;
+            }
+            playerAggregate.matches++;
+            playerAggregate.wins += result.winnerGid == player.gid;
+            playerAggregate.survived += player.alive;
+            for (size_t t = 0; t < ResourceType_COUNT; t++)
+            {
+                playerAggregate.collectedMean.at(t) += static_cast<double>(player.collected.at(t));
+            }
+            playerAggregate.totalMean += static_cast<double>(total);
+            playerAggregate.totalMin = std::min(playerAggregate.totalMin, total);
+            playerAggregate.totalMax = std::max(playerAggregate.totalMax, total);
+            playerAggregate.unitsLostMean += static_cast<double>(player.unitsLost);
+        }
+    }
+
+    auto count = static_cast<double>(results.size());
+    aggregate.gameTimeMean /= count;
+    for (auto& player : aggregate.players)
+    {
+        for (auto& mean : player.collectedMean)
+        {
+            mean /= count;
+        }
+        player.totalMean /= count;
+        player.unitsLostMean /= count;
+    }
+
+    return aggregate;
+}
+
+bool Tournament::WriteCsv(const std::string& path, const std::vector<MatchResult>& results, const Aggregate& aggregate)
+{
+    std::filesystem::path aggregatePath = path;
+    aggregatePath.replace_filename(aggregatePath.stem().string() + "_aggregate" + aggregatePath.extension().string());
+
+    std::ofstream file(path);
+    std::ofstream aggregateFile(aggregatePath);
+    if (!file || !aggregateFile)
+    {
+        fmt::print(stderr, "Could not open the CSV files '{}' and '{}'\n", path, aggregatePath.string());
+        return false;
+    }
+
+    file << "seed,ticks,game_time,finished,winner_gid,player,gid,name,alive";
+    for (uint8_t t = 0; t < ResourceType_COUNT; t++)
+    {
+        file << ',' << Resource::GetTypeName(static_cast<ResourceType>(t));
+    }
+    file << ",total,units_lost\n";
+    for (const auto& result : results)
+    {
+        for (size_t p = 0; p < result.players.size(); p++)
+        {
+            const auto& player = result.players.at(p);
+            file << fmt::format("{},{},{:.2f},{:d},{},{},{},{},{:d}", result.seed, result.ticks, result.gameTime,
+                                result.finished, result.winnerGid, p + 1, player.gid, CsvEscape(player.name), player.alive);
+            for (auto amount : player.collected)
+            {
+                file << ',' << amount;
+            }
+            file << fmt::format(",{},{}\n", Total(player.collected), player.unitsLost);
+        }
+    }
+
+    aggregateFile << "player,name,matches,finished,draws,game_time_mean,wins,survived";
+    for (uint8_t t = 0; t < ResourceType_COUNT; t++)
+    {
+        aggregateFile << ',' << Resource::GetTypeName(static_cast<ResourceType>(t)) << "_mean";
+    }
+    aggregateFile << ",total_mean,total_min,total_max,units_lost_mean\n";
+    for (size_t p = 0; p < aggregate.players.size(); p++)
+    {
+        const auto& player = aggregate.players.at(p);
+        aggregateFile << fmt::format("{},{},{},{},{},{:.2f},{},{}", p + 1, CsvEscape(player.name), aggregate.matches,
+                                     aggregate.finished, aggregate.draws, aggregate.gameTimeMean, player.wins, player.survived);
+        for (auto mean : player.collectedMean)
+        {
+            aggregateFile << fmt::format(",{:.2f}", mean);
+        }
+        aggregateFile << fmt::format(",{:.2f},{},{},{:.2f}\n", player.totalMean, player.totalMin, player.totalMax, player.unitsLostMean);
+    }
+
+    return static_cast<bool>(file) && static_cast<bool>(aggregateFile);
+}
+
+bool Tournament::WriteJson(const std::string& path, const std::vector<MatchResult>& results, const Aggregate& aggregate)
+{
+    std::ofstream file(path);
+    if (!file)
+    {
+        fmt::print(stderr, "Could not open the JSON file '{}'\n", path);
+        return false;
+    }
+
+    auto collectedToJson = [](const auto& collected, const char* format) {
+        std::string json = "{";
+        for (uint8_t t = 0; t < ResourceType_COUNT; t++)
+        {
+            json += fmt::format(fmt::runtime(format), t ? ", " : "", Resource::GetTypeName(static_cast<ResourceType>(t)), collected.at(t));
+        }
+        return json + "}";
+    };
+
+    file << "{\n  \"matches\": [\n";
+    for (size_t m = 0; m < results.size(); m++)
+    {
+        const auto& result = results.at(m);
+        file << fmt::format("    {{\"seed\": {}, \"ticks\": {}, \"game_time\": {:.2f}, \"finished\": {}, \"winner_gid\": {}, \"players\": [",
+                            result.seed, result.ticks, result.gameTime, result.finished, result.winnerGid);
+        for (size_t p = 0; p < result.players.size(); p++)
+        {
+            const auto& player = result.players.at(p);
+            file << fmt::format("{}{{\"player\": {}, \"gid\": {}, \"name\": \"{}\", \"alive\": {}, \"collected\": {}, \"total\": {}, \"units_lost\": {}}}",
+                                p ? ", " : "", p + 1, player.gid, JsonEscape(player.name), player.alive,
+                                collectedToJson(player.collected, "{}\"{}\": {}"), Total(player.collected), player.unitsLost);
+        }
+        file << (m + 1 < results.size() ? "]},\n" : "]}\n");
+    }
+    file << "  ],\n";
+
+    file << fmt::format("  \"aggregate\": {{\"matches\": {}, \"finished\": {}, \"draws\": {}, \"game_time_mean\": {:.2f}, \"game_time_min\": {:.2f}, \"game_time_max\": {:.2f}, \"players\": [\n",
+                        aggregate.matches, aggregate.finished, aggregate.draws, aggregate.gameTimeMean, aggregate.gameTimeMin, aggregate.gameTimeMax);
+    for (size_t p = 0; p < aggregate.players.size(); p++)
+    {
+        const auto& player = aggregate.players.at(p);
+        file << fmt::format("    {{\"player\": {}, \"name\": \"{}\", \"wins\": {}, \"survived\": {}, \"collected_mean\": {}, \"total_mean\": {:.2f}, \"total_min\": {}, \"total_max\": {}, \"units_lost_mean\": {:.2f}}}{}\n",
+                            p + 1, JsonEscape(player.name), player.wins, player.survived,
+                            collectedToJson(player.collectedMean, "{}\"{}\": {:.2f}"), player.totalMean, player.totalMin, player.totalMax,
+                            player.unitsLostMean, p + 1 < aggregate.players.size() ? "," : "");
+    }
+    file << "  ]}\n}\n";
+
+    return static_cast<bool>(file);
+}
+
+} // namespace oop::internal
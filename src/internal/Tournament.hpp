@@ -0,0 +1,139 @@
+/// @file Tournament.hpp
+/// @brief Plays many seeds in parallel and aggregates the results
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "game/resources/Resource.hpp"
+
+namespace oop::internal
+{
+
+/// @brief Runs one headless match per seed on a pool of worker threads
+class Tournament
+{
+  public:
+    /// @brief Default constructor
+    Tournament() = delete;
+
+    /// @brief Plays the seeds, prints a summary and writes the results
+    /// @param[in] firstSeed Seed of the first match. The following matches use the next seeds
+    /// @param[in] seedCount Amount of matches to play
+    /// @param[in] threadCount Amount of worker threads (0 to use all hardware threads)
+    /// @param[in] ticks Maximum amount of updates per match (a match stops as soon as it is finished)
+    /// @param[in] timeStep Time step of a single update in [s]
+    /// @param[in] csvPath File to write the results of every match to as CSV (empty to skip). The aggregated
+    ///                    results are written next to it with the suffix '_aggregate'
+    /// @param[in] jsonPath File to write the results of every match and the aggregated results to as JSON (empty to skip)
+    /// @return Exit code of the application
+    static int Run(uint64_t firstSeed, size_t seedCount, size_t threadCount, size_t ticks, float timeStep,
+                   const std::string& csvPath, const std::string& jsonPath);
+
+  private:
+    /// @brief Result of a single player in a match
+    struct PlayerResult
+    {
+        /// Global Id of the player
+        size_t gid = 0;
+        /// Name of the player
+        std::string name;
+        /// Whether the player was still alive at the end of the match
+        bool alive = false;
+        /// Collected resources per type
+        std::array<size_t, ResourceType_COUNT> collected{};
+        /// Amount of destroyed units (including the headquarter)
+        size_t unitsLost = 0;
+    };
+
+    /// @brief Result of a single match
+    struct MatchResult
+    {
+        /// Seed of the game random number generator
+        uint64_t seed = 0;
+        /// Amount of simulated updates
+        size_t ticks = 0;
+        /// Game time at the end of the match in [s]
+        float gameTime = 0.0F;
+        /// Whether the match finished within the maximum amount of updates
+        bool finished = false;
+        /// Global Id of the player who won (0 if nobody won)
+        size_t winnerGid = 0;
+        /// Results of the players in the order of the game (the neutral player is not included)
+        std::vector<PlayerResult> players;
+    };
+
+    /// @brief Results of a player over all matches. Players are identified by their position in the player list
+    struct PlayerAggregate
+    {
+        /// Name of the player
+        std::string name;
+        /// Amount of matches the player took part in
+        size_t matches = 0;
+        /// Amount of won matches
+        size_t wins = 0;
+        /// Amount of matches the player was alive at the end
+        size_t survived = 0;
+        /// Mean of the collected resources per type
+        std::array<double, ResourceType_COUNT> collectedMean{};
+        /// Mean of the total collected resources
+        double totalMean = 0.0;
+        /// Minimum of the total collected resources
+        size_t totalMin = 0;
+        /// Maximum of the total collected resources
+        size_t totalMax = 0;
+        /// Mean of the destroyed units
+        double unitsLostMean = 0.0;
+    };
+
+    /// @brief Results over all matches
+    struct Aggregate
+    {
+        /// Amount of played matches
+        size_t matches = 0;
+        /// Amount of matches which finished within the maximum amount of updates
+        size_t finished = 0;
+        /// Amount of matches nobody won
+        size_t draws = 0;
+        /// Mean of the game time in [s]
+        double gameTimeMean = 0.0;
+        /// Minimum of the game time in [s]
+        float gameTimeMin = 0.0F;
+        /// Maximum of the game time in [s]
+        float gameTimeMax = 0.0F;
+        /// Results per player
+        std::vector<PlayerAggregate> players;
+    };
+
+    /// @brief Simulates a single match in its own world
+    /// @param[in] seed Seed for the game random number generator
+    /// @param[in] ticks Maximum amount of updates to perform
+    /// @param[in] timeStep Time step of a single update in [s]
+    static MatchResult PlayMatch(uint64_t seed, size_t ticks, float timeStep);
+
+    /// @brief Accumulates the results of all matches
+    /// @param[in] results Results of the matches
+    static Aggregate Accumulate(const std::vector<MatchResult>& results);
+
+    /// @brief Writes the results of every match and the aggregated results as CSV files
+    /// @param[in] path File for the results of every match
+    /// @param[in] results Results of the matches
+    /// @param[in] aggregate Aggregated results
+    /// @return True if both files could be written
+    static bool WriteCsv(const std::string& path, const std::vector<MatchResult>& results, const Aggregate& aggregate);
+
+    /// @brief Writes the results of every match and the aggregated results as JSON file
+    /// @param[in] path File to write to
+    /// @param[in] results Results of the matches
+    /// @param[in] aggregate Aggregated results
+    /// @return True if the file could be written
+    static bool WriteJson(const std::string& path, const std::vector<MatchResult>& results, const Aggregate& aggregate);
+};
+
+} // namespace oop::internal
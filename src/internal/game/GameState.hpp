@@ -5,32 +5,28 @@
 
 #pragma once
 
-#include <array>
-#include <vector>
-#include <memory>
-#include <variant>
+#include <cstddef>
 
-#include "player/PlayerBase.hpp"
-#include "resources/Resource.hpp"
-#include "positioning/Satellite.hpp"
+#include "World.hpp"
+#include "internal/SimulationThread.hpp"
 
 namespace oop::internal
 {
 
-class Unit;
-
+/// @brief Game state shown in the GUI. The logic itself lives in the World class, which is updated by the simulation thread.
+///
+/// The drawing functions only read the render state fetched last and never touch the world.
 class GameState
 {
   public:
     /// @brief Default Constructor
     GameState() = delete;
 
-    /// @brief Called when the application is started
+    /// @brief Called when the application is started. Starts the simulation thread with a new match
     static void OnStart();
 
-    /// @brief Update the game state for the time passed
-    /// @param[in] deltaTime Time since last frame
-    static void Update(float deltaTime);
+    /// @brief Called when the application is stopped. Stops the simulation thread
+    static void OnStop();
 
     /// @brief Draw the current state of the game
     static void Draw();
@@ -40,38 +36,21 @@ class GameState
     static void DrawGameStats(float availableWidth);
 
   private:
-    /// @brief Get the next Global Id
-    static size_t GetNextGID();
-
-    /// @brief Get a new resource position
-    /// @param[in] maxDistance Maximum rectangular distance the object should have to the center position
-    static Eigen::Vector2f GetNewResourcePosition(const Eigen::Vector2f& center = { 0, 0 }, float maxDistance = -1.0F);
-
-    /// @brief Get a new satellite position and heading
-    static std::pair<Eigen::Vector2f, float> GetNewSatellitePositionAndHeading();
-
-    /// @brief List of all players (for now only one)
-    static std::vector<std::shared_ptr<PlayerBase>> players;
+    /// @brief The world shown in the GUI (only accessed by the simulation thread and by commands posted to it)
+    static inline World world;
 
-    /// @brief List of all resources spawned on the map
-    static std::vector<Resource> resources;
+    /// @brief Thread updating the world
+    static inline SimulationThread simulation{ world };
 
-    /// @brief List of all satellites spawned on the map
-    static std::vector<Satellite> satellites;
+    /// @brief Global id of the object selected by the user (0 if nothing is selected)
+    static inline size_t selectedGid = 0;
 
-    /// @brief Currently selected unit by the user
-    static std::variant<std::shared_ptr<const Unit>,
-                        const Resource*,
-                        const Satellite*>
-        selectedObject;
+    /// @brief Draws the overlays of the units if the world is not updated right now
+    static void DrawOverlays();
 
-    friend class PlayerBase;
-    friend class Unit;
-    friend class RobotBase;
-    friend class HeadquartersBase;
-    friend class Virus;
-    friend class Resource;
-    friend class Satellite;
+    friend class GameApplication;
+    friend class ControlPanel;
+    friend class GlobalWindows;
 };
 
-} // namespace oop::internal
\ No newline at end of file
+} // namespace oop::internal
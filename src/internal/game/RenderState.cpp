@@ -0,0 +1,136 @@
+#include "RenderState.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "internal/game/Settings.hpp"
+#include "internal/game/World.hpp"
+#include "internal/game/player/PlayerBase.hpp"
+
+namespace oop::internal
+{
+
+void RenderState::Capture(const World& world, bool withScanLines)
+{
+    players.resize(world.m_players.size());
+    size_t unitCount = 0;
+    for (size_t p = 0; p < world.m_players.size(); p++)
+    {
+        const auto& player = *world.m_players[p];
+        auto& view = players[p];
+        view.gid = player.m_gid;
+        view.name = player.GetName();
+        view.color = player.GetColor();
+        view.unitCount = player.m_units.size();
+        view.resources = player.m_resources;
+        view.collectedResourcesTotal = player.m_collectedResourcesTotal;
+        unitCount += player.m_units.size();
+    }
+
+    satellites.resize(world.m_satellites.size());
+    for (size_t i = 0; i < world.m_satellites.size(); i++)
+    {
+        const auto& satellite = world.m_satellites.at(i);
+        auto& view = satellites[i];
+        view.gid = satellite.m_gid;
+        view.pos = satellite.Position(world.m_satelliteTime);
+        view.speed = satellite.m_speed;
+        view.heading = satellite.m_heading;
+        view.isFaulty = satellite.m_isFaulty;
+        view.faultyPos = satellite.FaultyPosition(world.m_satelliteTime);
+        view.faultySpeed = satellite.m_faultySpeed;
+    }
+
+    units.resize(unitCount);
+    scanLines.clear();
+    size_t u = 0;
+    for (const auto& player : world.m_players)
+    {
+        for (const auto& unit : player->m_units)
+        {
+            auto& view = units[u++];
+            view.gid = unit->m_gid;
+            view.playerGid = player->m_gid;
+            view.color = player->GetColor();
+            view.kind = unit->IsHeadquarters() ? UnitKind_Headquarters
+                                               : (player->m_gid ? UnitKind_Robot : UnitKind_Virus);
+            view.typeName = unit->GetUnitTypeName();
+            view.pos = unit->m_pos;
+            view.heading = unit->m_heading;
+            view.headingBias = unit->m_headingBias;
+            view.drawSize = unit->GetDrawSize();
+            view.currentHealth = unit->m_currentHealth;
+            view.maxHealth = unit->m_maxHealth;
+            view.speed = unit->m_speed;
+            view.scanRange = unit->m_scanRange;
+            view.collectRange = unit->m_collectRange;
+            view.resourceContainerSize = unit->m_resourceContainerSize;
+            view.attackPower = unit->m_attackPower;
+            view.attackRange = unit->m_attackRange;
+            view.attackBlockTime = unit->m_attackBlockTime;
+            view.lastAttackedUnitPosition = unit->m_lastAttackedUnitPosition;
+            view.resourcesCarried = unit->m_resourcesCarried;
+            view.satelliteCount = 0;
+            if (player->m_gid) // Neutral units dont need satellites
+            {
+                view.satelliteCount = static_cast<size_t>(std::count_if(satellites.begin(), satellites.end(), [&unit](const SatelliteView& satellite) {
+                    return !satellite.isFaulty && (unit->m_pos - satellite.pos).norm() <= glob::positioning::VISIBILITY_RANGE;
+                }));
+            }
+            view.clockOffset = unit->m_clockOffset;
+            view.action = unit->m_actionTooltip;
+
+            view.scanLinesBegin = scanLines.size();
+            if (withScanLines)
+            {
+                auto lineTarget = [&unit](float distance, float heading) -> Eigen::Vector2f {
+                    return unit->m_pos + distance * Eigen::Vector2f{ std::cos(heading + static_cast<float>(M_PI_2)), std::sin(heading + static_cast<float>(M_PI_2)) };
+                };
+                // Only the scans the unit made in the last update are shown, as the others were not computed
+                if (!unit->m_unitScanOutdated)
+                {
+                    for (const auto& scanResult : unit->m_currentUnitScan)
+                    {
+                        Color color{ 153, 76, 0 };
+                        if (const auto* scannedPlayer = world.FindPlayer(scanResult.playerId))
+                        {
+                            color = scannedPlayer->GetColor();
+                        }
+                        scanLines.push_back({ lineTarget(scanResult.distance, scanResult.heading), color });
+                    }
+                }
+                if (!unit->m_resourceScanOutdated)
+                {
+                    for (const auto& scanResult : unit->m_currentResourceScan)
+                    {
+                        scanLines.push_back({ lineTarget(scanResult.distance, scanResult.heading), Resource::color(scanResult.type) });
+                    }
+                }
+            }
+            view.scanLinesCount = scanLines.size() - view.scanLinesBegin;
+        }
+    }
+
+    resources.resize(world.m_resources.size());
+    for (size_t i = 0; i < world.m_resources.size(); i++)
+    {
+        const auto& resource = world.m_resources.at(i);
+        auto& view = resources[i];
+        view.gid = resource.m_gid;
+        view.type = resource.m_type;
+        view.amount = resource.m_amount;
+        view.pos = resource.m_pos;
+        view.heading = resource.m_heading;
+        view.drawSize = resource.GetDrawSize();
+    }
+
+    gameTime = world.m_gameTime;
+    tick = world.m_tick;
+    gameTimeLimit = world.m_gameTimeLimit;
+    gameRunning = world.m_gameRunning;
+    gameFinished = world.m_gameFinished;
+    winningPlayerColor = world.m_winningPlayerColor;
+    seed = world.m_gameRng.seed;
+}
+
+} // namespace oop::internal
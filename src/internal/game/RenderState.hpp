@@ -0,0 +1,201 @@
+/// @file RenderState.hpp
+/// @brief Read-only copy of everything the GUI shows of a world
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "internal/game/resources/Resource.hpp"
+#include "internal/game/units/Unit.hpp"
+#include "internal/helper/Color.hpp"
+#include "internal/helper/Profiler.hpp"
+
+namespace oop::internal
+{
+
+class World;
+
+/// @brief Plain values of the players, units, resources and satellites of a world after an update.
+///
+/// The simulation thread captures the world into a render state and hands it to the GUI, which draws only from it and
+/// never touches the world itself. The containers are reused by the next capture, so capturing does not allocate once
+/// they reached their size.
+struct RenderState
+{
+    /// @brief Kind of a unit, which selects how it is drawn
+    enum UnitKind : uint8_t
+    {
+        UnitKind_Headquarters, ///< Headquarters of a player
+        UnitKind_Robot,        ///< Robot of a player
+        UnitKind_Virus,        ///< Unit of the neutral player
+    };
+
+    /// @brief Line from a unit to an object found by its last scan
+    struct ScanLine
+    {
+        Eigen::Vector2f target{ 0.0F, 0.0F }; ///< Position of the object
+        Color color;                          ///< Color of the object
+    };
+
+    /// @brief Player with its statistics
+    struct PlayerView
+    {
+        size_t gid = 0;                                                   ///< Global id (the neutral player has 0)
+        std::string name;                                                 ///< Name of the player
+        Color color;                                                      ///< Color of the player
+        size_t unitCount = 0;                                             ///< Amount of units including the headquarters
+        std::array<size_t, ResourceType_COUNT> resources{};               ///< Resources currently owned
+        std::array<size_t, ResourceType_COUNT> collectedResourcesTotal{}; ///< Resources collected in total
+    };
+
+    /// @brief Unit with all values shown on the board and in the tooltip
+    struct UnitView
+    {
+        size_t gid = 0;                                         ///< Global id
+        size_t playerGid = 0;                                   ///< Global id of the player who owns the unit
+        Color color;                                            ///< Color of the player who owns the unit
+        UnitKind kind = UnitKind_Robot;                         ///< Kind of the unit
+        std::string typeName;                                   ///< Type name of the unit
+        Eigen::Vector2f pos{ 0.0F, 0.0F };                      ///< Position
+        float heading = 0.0F;                                   ///< Heading [rad]
+        float headingBias = 0.0F;                               ///< Heading bias [rad]
+        float drawSize = 0.0F;                                  ///< Size of the unit
+        float currentHealth = 0.0F;                             ///< Health
+        float maxHealth = 0.0F;                                 ///< Maximum health
+        float speed = 0.0F;                                     ///< Speed without the decrease while carrying
+        float scanRange = 0.0F;                                 ///< Scan range
+        float collectRange = 0.0F;                              ///< Collect range
+        int resourceContainerSize = 0;                          ///< Amount of resources the unit can carry
+        int attackPower = 0;                                    ///< Damage per attack
+        float attackRange = 0.0F;                               ///< Attack range
+        float attackBlockTime = 0.0F;                           ///< Time the unit is prevented from attacking
+        Eigen::Vector2f lastAttackedUnitPosition{ 0.0F, 0.0F }; ///< Position of the last attacked unit
+        std::pair<ResourceType, size_t> resourcesCarried;       ///< Type and amount of the carried resources
+        size_t satelliteCount = 0;                              ///< Amount of satellites in range
+        double clockOffset = 0.0;                               ///< Clock offset of the distance measurements
+        Unit::Action action = Unit::Action_None;                ///< Last planned action
+        size_t scanLinesBegin = 0;                              ///< Index of the first scan line of the unit
+        size_t scanLinesCount = 0;                              ///< Amount of scan lines of the unit
+
+#ifndef OOP_HEADLESS
+        /// @brief Draws the unit into the current plot
+        /// @param[in] state State the unit belongs to
+        /// @param[in] selected Flag whether the user selected the unit
+        void Draw(const RenderState& state, bool selected) const;
+
+      private:
+        /// @brief Draws the debug information and the attack animation all kinds of units have
+        /// @param[in] state State the unit belongs to
+        void DrawCommon(const RenderState& state) const;
+
+        /// @brief Draws the shape of a robot
+        /// @param[in] selected Flag whether the user selected the unit
+        void DrawRobot(bool selected) const;
+
+        /// @brief Draws the shape of a headquarters
+        /// @param[in] selected Flag whether the user selected the unit
+        void DrawHeadquarters(bool selected) const;
+
+        /// @brief Draws the shape of a virus
+        /// @param[in] selected Flag whether the user selected the unit
+        void DrawVirus(bool selected) const;
+#endif
+    };
+
+    /// @brief Resource on the board
+    struct ResourceView
+    {
+        size_t gid = 0;                        ///< Global id
+        ResourceType type = ResourceType_Coil; ///< Type of the resource
+        int amount = 0;                        ///< Amount of resources contained
+        Eigen::Vector2f pos{ 0.0F, 0.0F };     ///< Position
+        float heading = 0.0F;                  ///< Heading [rad]
+        float drawSize = 0.0F;                 ///< Size of the resource
+
+#ifndef OOP_HEADLESS
+        /// @brief Draws the resource into the current plot
+        /// @param[in] selected Flag whether the user selected the resource
+        void Draw(bool selected) const;
+#endif
+    };
+
+    /// @brief Satellite flying over the board
+    struct SatelliteView
+    {
+        size_t gid = 0;                          ///< Global id
+        Eigen::Vector2f pos{ 0.0F, 0.0F };       ///< Position
+        float speed = 0.0F;                      ///< Speed
+        float heading = 0.0F;                    ///< Heading [rad]
+        bool isFaulty = false;                   ///< Flag whether the satellite transmits a wrong position
+        Eigen::Vector2f faultyPos{ 0.0F, 0.0F }; ///< Transmitted position of a faulty satellite
+        float faultySpeed = 0.0F;                ///< Transmitted speed of a faulty satellite
+
+#ifndef OOP_HEADLESS
+        /// @brief Draws the satellite into the current plot
+        /// @param[in] selected Flag whether the user selected the satellite
+        void Draw(bool selected) const;
+#endif
+    };
+
+    /// @brief Sum of the values a profiler zone or counter recorded on the simulation thread
+    struct ProfilerTotal
+    {
+        const char* name = nullptr;                          ///< Name of the zone or counter (string literal)
+        Profiler::EventType type = Profiler::EventType_Zone; ///< Type of the events
+        double sum = 0.0;                                    ///< Sum of the durations in [ns] or of the counter values
+        uint64_t samples = 0;                                ///< Amount of events
+    };
+
+    /// @brief Copies the state of the world. The fields of the simulation thread (updates, attacks, ...) stay untouched
+    /// @param[in] world World to copy
+    /// @param[in] withScanLines Flag whether the scan lines of the units should be copied as well
+    void Capture(const World& world, bool withScanLines);
+
+    /// Players in the order of the world (the neutral player is the first one)
+    std::vector<PlayerView> players;
+    /// Units of all players in their update order
+    std::vector<UnitView> units;
+    /// Resources on the board
+    std::vector<ResourceView> resources;
+    /// Satellites on the board
+    std::vector<SatelliteView> satellites;
+    /// Scan lines of all units (empty if they were not requested)
+    std::vector<ScanLine> scanLines;
+
+    /// Game time [s]
+    float gameTime = 0.0F;
+    /// Amount of updates performed while the game was running
+    uint64_t tick = 0;
+    /// Game time limit [s]
+    int32_t gameTimeLimit = 0;
+    /// Flag whether the game is running
+    bool gameRunning = false;
+    /// Flag whether the game is finished (2 until the user confirmed it)
+    int gameFinished = 0;
+    /// Color of the player who won the round (transparent if nobody won)
+    Color winningPlayerColor{ 0, 0, 0, 0 };
+    /// Seed of the game random number generator
+    uint64_t seed = 0;
+
+    /// Update time step the simulation thread uses [s]
+    float timeStep = 0.0F;
+    /// Amount of updates the simulation thread performed since it was started
+    uint64_t updates = 0;
+    /// Amount of updates in which an attack occurred since the simulation thread was started
+    uint64_t attacks = 0;
+    /// Amount of commands the simulation thread applied to the world
+    uint64_t commandsApplied = 0;
+    /// Profiler zones and counters the simulation thread recorded since it was started
+    std::vector<ProfilerTotal> profilerTotals;
+};
+
+} // namespace oop::internal
@@ -8,6 +8,8 @@
 #include <array>
 #include <cmath>
 
+#include "internal/helper/Color.hpp"
+
 namespace oop::glob
 {
 namespace debug
@@ -37,6 +39,17 @@ constexpr size_t NUM_PLAYERS = 1;
 /// @brief Time steps taken to update the game
 float inline UPDATE_TIME_STEP = 1e-2F;
 
+/// @brief Splits every update into a Think phase, in which all units decide on the same state in parallel,
+///        and a commit phase, which applies the planned actions in the order of the global ids
+bool inline PHASED_UPDATE = false;
+
+/// @brief Amount of threads running the Think phase of the phased update (1 runs it on the updating thread)
+size_t inline THINK_THREADS = 1;
+
+/// @brief Draws the random numbers of every entity from its own counter-based stream keyed by (seed, global id, tick, purpose)
+///        instead of the shared generator, so that they do not depend on the update order or on other entities
+bool inline RANDOM_STREAMS = false;
+
 /// @brief Range for the game board width
 constexpr std::array<double, 2> BOARD_WIDTH{ -100.0, 100.0 };
 /// @brief Range for the game board height
@@ -244,8 +257,27 @@ constexpr float HOVER_OBJECT_SIZE_MODIFIER = 0.7F;
 /// @brief Size of the hovering effect
 constexpr float HOVER_BACKGROUND_WIDTH = 0.05F;
 
-const ImColor COLOR_SELECTED{ 255, 255, 255, 160 };
-const ImColor COLOR_HOVERED{ 224, 224, 224, 90 };
+constexpr Color COLOR_SELECTED{ 255, 255, 255, 160 };
+constexpr Color COLOR_HOVERED{ 224, 224, 224, 90 };
+
+/// @brief Color of the neutral player
+constexpr Color COLOR_NEUTRAL_PLAYER{ 224, 224, 224 };
+
+/// @brief File the Save and Load buttons write the snapshot of the match to (relative to the working directory)
+constexpr const char* SNAPSHOT_PATH = "snapshot.oopsnap";
+
+/// @brief Colors of the players (ImPlot 'Dark' colormap)
+constexpr std::array<Color, 9> COLOR_PLAYERS = { {
+    { 228, 26, 28 },
+    { 55, 126, 184 },
+    { 77, 175, 74 },
+    { 152, 78, 163 },
+    { 255, 127, 0 },
+    { 255, 255, 51 },
+    { 166, 86, 40 },
+    { 247, 129, 191 },
+    { 153, 153, 153 },
+} };
 } // namespace gui
 
 namespace camera
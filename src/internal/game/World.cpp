@@ -0,0 +1,915 @@
+#include "World.hpp"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <utility>
+
+#include "internal/game/Settings.hpp"
+#include "internal/helper/AllocationCounter.hpp"
+#include "internal/helper/Profiler.hpp"
+#include "internal/helper/TickArena.hpp"
+#include "internal/game/resources/Resource.hpp"
+#include "internal/game/neutral/NeutralPlayer.hpp"
+
+#include "TEAMNAME/units/Robot.hpp"
+#include "TEAMNAME/units/Headquarters.hpp"
+#include "TEAMNAME/player/Player.hpp"
+
+// #######################################################################################
+// #######################################################################################
+
+#define PLAYER_1 TEAMNAME
+#define PLAYER_2 TEAMNAME
+
+namespace oop::internal
+{
+
+namespace
+{
+
+/// World bound to the current thread
+thread_local World* currentWorld = nullptr;
+
+/// Random number generator replacing the user one on the current thread (e.g. of the unit currently thinking)
+thread_local RandomNumberGenerator* boundUserRng = nullptr;
+
+/// Random number streams of the current thread per purpose
+thread_local std::array<RandomNumberGenerator, RandomPurpose_COUNT> userRngStreams;
+
+} // namespace
+
+World::Scope::Scope(World& world)
+    : m_previous(currentWorld)
+{
+    currentWorld = &world;
+}
+
+World::Scope::~Scope()
+{
+    currentWorld = m_previous;
+}
+
+World& World::Current()
+{
+    assert(currentWorld && "No world bound to this thread. Create a World::Scope first.");
+    return *currentWorld;
+}
+
+size_t World::GetNextGID()
+{
+    return m_currentGid++;
+}
+
+World::GidEntry& World::GidIndexEntry(size_t gid)
+{
+    if (gid >= m_gidIndex.size())
+    {
+        m_gidIndex.resize(std::max(gid + 1, m_currentGid));
+    }
+    return m_gidIndex[gid];
+}
+
+Unit* World::FindUnit(size_t gid) const
+{
+    return gid < m_gidIndex.size() ? m_gidIndex[gid].unit : nullptr;
+}
+
+Resource* World::FindResource(size_t gid)
+{
+    return gid < m_gidIndex.size() ? m_resources.Get(m_gidIndex[gid].resource) : nullptr;
+}
+
+PlayerBase* World::FindPlayer(size_t gid) const
+{
+    return gid < m_gidIndex.size() ? m_gidIndex[gid].player : nullptr;
+}
+
+void World::SpawnResource(ResourceType type, int amount, const Eigen::Vector2f& position, float heading)
+{
+    auto handle = m_resources.Emplace(type, amount, position, heading);
+    GidIndexEntry(m_resources.back().m_gid).resource = handle;
+    m_resourceGrid.Insert(m_resources.back().m_pos, m_resources.size() - 1);
+}
+
+void World::SpawnSatellite(const Eigen::Vector2f& position, float heading)
+{
+    auto handle = m_satellites.Emplace(position, heading, m_satelliteTime);
+    GidIndexEntry(m_satellites.back().m_gid).satellite = handle;
+}
+
+void World::RebuildGidIndex()
+{
+    m_gidIndex.clear();
+    for (const auto& player : m_players)
+    {
+        GidIndexEntry(player->m_gid).player = player.get();
+        for (const auto& unit : player->m_units)
+        {
+            GidIndexEntry(unit->m_gid).unit = unit.get();
+        }
+    }
+    for (size_t i = 0; i < m_resources.size(); i++)
+    {
+        GidIndexEntry(m_resources.at(i).m_gid).resource = m_resources.HandleAt(i);
+    }
+    for (size_t i = 0; i < m_satellites.size(); i++)
+    {
+        GidIndexEntry(m_satellites.at(i).m_gid).satellite = m_satellites.HandleAt(i);
+    }
+}
+
+std::shared_ptr<PlayerBase> World::CreatePlayer(size_t index, const Eigen::Vector2f& position, const Color& color)
+{
+    switch (index)
+    {
+    case 0:
+        return std::make_shared<PLAYER_1::Player>(position, color);
+    case 1:
+        return std::make_shared<PLAYER_2::Player>(position, color);
+    default:
+        return std::make_shared<TEAMNAME::Player>(position, color);
+    }
+}
+
+UnitPtr World::CreateHeadquarters(size_t index, PlayerBase* parent, size_t gid, const Eigen::Vector2f& position, float heading)
+{
+    switch (index)
+    {
+    case 0:
+        return m_unitPool.Create<PLAYER_1::Headquarters>(parent, gid, position, heading);
+    case 1:
+        return m_unitPool.Create<PLAYER_2::Headquarters>(parent, gid, position, heading);
+    default:
+        return m_unitPool.Create<TEAMNAME::Headquarters>(parent, gid, position, heading);
+    }
+}
+
+UnitPtr World::CreateRobot(size_t index, PlayerBase* parent, const Eigen::Vector2f& position, float heading)
+{
+    switch (index)
+    {
+    case 0:
+        return m_unitPool.Create<PLAYER_1::Robot>(parent, position, heading);
+    case 1:
+        return m_unitPool.Create<PLAYER_2::Robot>(parent, position, heading);
+    default:
+        return m_unitPool.Create<TEAMNAME::Robot>(parent, position, heading);
+    }
+}
+
+World::UserRngBinding::UserRngBinding(RandomNumberGenerator& rng)
+    : m_previous(std::exchange(boundUserRng, &rng)) {}
+
+World::UserRngBinding::~UserRngBinding()
+{
+    boundUserRng = m_previous;
+}
+
+RandomNumberGenerator& World::UserRng()
+{
+    if (boundUserRng)
+    {
+        return *boundUserRng;
+    }
+    return m_gameRunning ? m_userRng : m_userRngPause;
+}
+
+RandomNumberGenerator& World::UserRng(size_t gid, RandomPurpose purpose)
+{
+    if (!glob::game::RANDOM_STREAMS)
+    {
+        return UserRng();
+    }
+
+    auto& stream = userRngStreams.at(purpose);
+    stream.resetStream(m_userRng.seed, gid, m_tick, purpose);
+    return stream;
+}
+
+void World::PlayerThink(PlayerBase& player, float deltaTime)
+{
+    if (glob::game::RANDOM_STREAMS)
+    {
+        UserRngBinding rngBinding(UserRng(player.m_gid, RandomPurpose_Think));
+        player.Think(deltaTime);
+    }
+    else
+    {
+        player.Think(deltaTime);
+    }
+}
+
+Eigen::Vector2f World::GetNewResourcePosition(const Eigen::Vector2f& center, float maxDistance)
+{
+    Eigen::Vector2f pos;
+
+    bool positionCloseToOthers = false;
+    do
+    {
+        positionCloseToOthers = false;
+        if (maxDistance == -1)
+        {
+            pos = Eigen::Vector2f{ m_gameRng.uniform_real_distribution<double>(glob::game::BOARD_WIDTH.at(0) * 0.95,
+                                                                               glob::game::BOARD_WIDTH.at(1) * 0.95),
+                                   m_gameRng.uniform_real_distribution<double>(glob::game::BOARD_HEIGHT.at(0) * 0.95,
+                                                                               glob::game::BOARD_HEIGHT.at(1) * 0.95) };
+        }
+        else
+        {
+            auto heading = m_gameRng.uniform_real_distribution<float>(0, 2.0 * static_cast<float>(M_PI));
+            auto distance = m_gameRng.uniform_real_distribution<float>(glob::resources::MIN_DISTANCE_RESOURCE_TO_HQ, maxDistance);
+            pos = center + distance * Eigen::Vector2f{ std::cos(heading), std::sin(heading) };
+            if (pos.x() < glob::game::BOARD_WIDTH.at(0) * 0.95
+                || pos.x() > glob::game::BOARD_WIDTH.at(1) * 0.95
+                || pos.y() < glob::game::BOARD_HEIGHT.at(0) * 0.95
+                || pos.y() > glob::game::BOARD_HEIGHT.at(1) * 0.95)
+            {
+                positionCloseToOthers = true;
+                continue;
+            }
+        }
+        if (pos.x() < glob::game::BOARD_WIDTH.at(0) + 20 && pos.y() < glob::game::BOARD_HEIGHT.at(0) + 20) // Do not spawn resources inside the logo
+        {
+            positionCloseToOthers = true;
+            continue;
+        }
+
+        for (size_t i = 1; i < m_players.size(); i++)
+        {
+            const auto& hq = m_players.at(i)->m_units.front();
+
+            if ((pos - hq->m_pos).norm() <= glob::resources::MIN_DISTANCE_RESOURCE_TO_HQ_LIMITED
+                && m_itemsCloseToPlayer.at(i - 1) >= glob::resources::RESOURCES_ALLOWED_CLOSE_TO_HQ)
+            {
+                positionCloseToOthers = true;
+                break;
+            }
+
+            if ((pos - hq->m_pos).norm() <= glob::resources::MIN_DISTANCE_RESOURCE_TO_HQ)
+            {
+                positionCloseToOthers = true;
+                break;
+            }
+        }
+        if (positionCloseToOthers)
+        {
+            continue;
+        }
+
+        m_resourceGrid.ForEachInRadius(pos, glob::resources::MIN_DISTANCE_RESOURCE_TO_RESOURCE + SpatialGrid<size_t>::TOLERANCE,
+                                       [&pos, &positionCloseToOthers](const Eigen::Vector2f& resourcePos, size_t /* index */) {
+                                           if ((pos - resourcePos).norm() <= glob::resources::MIN_DISTANCE_RESOURCE_TO_RESOURCE)
+                                           {
+                                               positionCloseToOthers = true;
+                                           }
+                                       });
+
+    } while (positionCloseToOthers);
+
+    for (size_t i = 1; i < m_players.size(); i++)
+    {
+        const auto& hq = m_players.at(i)->m_units.front();
+        if ((pos - hq->m_pos).norm() <= glob::resources::MIN_DISTANCE_RESOURCE_TO_HQ_LIMITED)
+        {
+            m_itemsCloseToPlayer.at(i - 1)++;
+        }
+    }
+
+    return pos;
+}
+
+std::pair<Eigen::Vector2f, float> World::GetNewSatellitePositionAndHeading()
+{
+    auto heading = static_cast<float>(m_gameRng.normal_distribution<double>(-M_PI_2, M_PI_2));
+    auto startBorder = m_gameRng.uniform_int_distribution<size_t>(0, 3);
+
+    heading += static_cast<float>(startBorder) * static_cast<float>(M_PI_2);
+
+    Eigen::Vector2f pos;
+    if (startBorder == 0 || startBorder == 2) // Bottom || Top
+    {
+        auto center = (glob::game::BOARD_WIDTH.at(0) + glob::game::BOARD_WIDTH.at(1)) / 2.0;
+        auto range = (glob::game::BOARD_WIDTH.at(0) - glob::game::BOARD_WIDTH.at(1)) / 2.0;
+        pos = Eigen::Vector2f{ m_gameRng.normal_distribution<>(center, 0.8 * range, glob::game::BOARD_WIDTH.at(0), glob::game::BOARD_WIDTH.at(1)),
+                               glob::game::BOARD_HEIGHT.at(startBorder / 2) };
+    }
+    else if (startBorder == 1 || startBorder == 3) // Right || Left
+    {
+        auto center = (glob::game::BOARD_HEIGHT.at(0) + glob::game::BOARD_HEIGHT.at(1)) / 2.0;
+        auto range = std::abs(glob::game::BOARD_HEIGHT.at(0) - glob::game::BOARD_HEIGHT.at(1)) / 2.0;
+        pos = Eigen::Vector2f{ glob::game::BOARD_WIDTH.at(startBorder % 3),
+                               m_gameRng.normal_distribution<>(center, 0.8 * range, glob::game::BOARD_HEIGHT.at(0), glob::game::BOARD_HEIGHT.at(1)) };
+    }
+
+    return { pos, heading };
+}
+
+void World::RebuildResourceGrid()
+{
+    m_resourceGrid.Clear(glob::game::BOARD_WIDTH, glob::game::BOARD_HEIGHT, glob::units::ATTR_MAX_SCAN_RANGE);
+    for (size_t i = 0; i < m_resources.size(); i++)
+    {
+        m_resourceGrid.Insert(m_resources.at(i).m_pos, i);
+    }
+    m_resourceGrid.Sort();
+}
+
+void World::UpdateNeighbourLists(float deltaTime)
+{
+    float maxSpeed = 0.0F;
+    float maxDisplacementSquared = 0.0F;
+    size_t index = 0;
+    bool outdated = m_neighbourListsOutdated || m_neighbourListUnitCount.size() != m_players.size();
+    for (size_t p = 0; p < m_players.size() && !outdated; p++)
+    {
+        const auto& units = m_players.at(p)->m_units;
+        outdated = units.size() != m_neighbourListUnitCount.at(p); // Units were spawned
+        for (size_t u = 0; u < units.size() && !outdated; u++, index++)
+        {
+            maxSpeed = std::max(maxSpeed, std::abs(units.at(u)->m_speed) + glob::units::SPEED_DECREASE_WHILE_CARRYING);
+            maxDisplacementSquared = std::max(maxDisplacementSquared, (units.at(u)->m_pos - m_neighbourReferencePositions.at(index)).squaredNorm());
+        }
+    }
+
+    // Units move at most once per update, so every unit has to stay within half the skin till the end of the update
+    const float maxStep = m_gameRunning ? maxSpeed * deltaTime : 0.0F;
+    if (outdated || std::sqrt(maxDisplacementSquared) + maxStep > 0.5F * m_neighbourSkin)
+    {
+        RebuildNeighbourLists(deltaTime);
+    }
+}
+
+void World::RebuildNeighbourLists(float deltaTime)
+{
+    float maxScanRange = 0.0F;
+    float maxSpeed = 0.0F;
+    for (const auto& player : m_players)
+    {
+        for (const auto& unit : player->m_units)
+        {
+            maxScanRange = std::max(maxScanRange, unit->m_scanRange);
+            maxSpeed = std::max(maxSpeed, std::abs(unit->m_speed) + glob::units::SPEED_DECREASE_WHILE_CARRYING);
+        }
+    }
+    m_neighbourSkin = std::max(NEIGHBOUR_SKIN, 2.0F * (m_gameRunning ? maxSpeed * deltaTime : 0.0F));
+
+    m_unitGrid.Clear(glob::game::BOARD_WIDTH, glob::game::BOARD_HEIGHT, maxScanRange + m_neighbourSkin);
+    m_neighbourListUnitCount.resize(m_players.size());
+    m_neighbourReferencePositions.clear();
+    for (size_t p = 0; p < m_players.size(); p++)
+    {
+        const auto& units = m_players.at(p)->m_units;
+        for (size_t u = 0; u < units.size(); u++)
+        {
+            m_unitGrid.Insert(units.at(u)->m_pos, { (uint64_t{ p } << 32U) | u, units.at(u).get() });
+            units.at(u)->m_neighbourListIndex = m_neighbourReferencePositions.size();
+            m_neighbourReferencePositions.push_back(units.at(u)->m_pos);
+        }
+        m_neighbourListUnitCount.at(p) = units.size();
+    }
+    m_unitGrid.Sort();
+
+    m_neighbours.clear();
+    m_neighbourOffsets.clear();
+    for (const auto& player : m_players)
+    {
+        for (const auto& unit : player->m_units)
+        {
+            m_neighbourOffsets.push_back(m_neighbours.size());
+            m_unitGrid.ForEachInRadius(unit->m_pos, unit->m_scanRange + m_neighbourSkin + SpatialGrid<UnitGridEntry>::TOLERANCE,
+                                       [this, &unit](const Eigen::Vector2f& /* position */, const UnitGridEntry& entry) {
+                                           if (entry.unit != unit.get())
+                                           {
+                                               m_neighbours.push_back(entry);
+                                           }
+                                       });
+            std::sort(m_neighbours.begin() + static_cast<std::ptrdiff_t>(m_neighbourOffsets.back()), m_neighbours.end(),
+                      [](const auto& lhs, const auto& rhs) { return lhs.order < rhs.order; });
+        }
+    }
+    m_neighbourOffsets.push_back(m_neighbours.size());
+    m_neighbourListsOutdated = false;
+}
+
+void World::OnStart()
+{
+    Scope scope(*this);
+
+    // ------------------------------------------------- Reset ---------------------------------------------------
+    m_currentGid = 1;
+    m_gidIndex.clear();
+    m_players.clear();
+    m_resources.clear();
+    RebuildResourceGrid();
+    m_satellites.clear();
+    m_itemsCloseToPlayer.clear();
+
+    m_gameRng.reset();
+
+    m_userRng.useSeedInsteadOfSystemTime = true;
+    m_userRng.seed = m_gameRng.uniform_int_distribution<uint64_t>();
+    m_userRng.reset();
+    m_userRngPause.useSeedInsteadOfSystemTime = true;
+    m_userRngPause.seed = m_gameRng.uniform_int_distribution<uint64_t>();
+    m_userRngPause.reset();
+    m_gameRunning = false;
+    m_changedSinceUpdate = true;
+    m_neighbourListsOutdated = true;
+
+    m_gameTime = 0.0F;
+    m_satelliteTime = 0.0F;
+    m_tick = 0;
+    m_gameFinished = 0;
+    m_winningPlayerColor = { 0, 0, 0, 0 };
+    m_winningPlayerGid = 0;
+
+    // ----------------------------------------------- Start new -------------------------------------------------
+
+    std::array<float, ResourceType_COUNT> availableResources{};
+
+    m_players.reserve(glob::game::NUM_PLAYERS + 1);
+
+    // Neutral unit player
+    m_players.push_back(std::make_shared<NeutralPlayer>(glob::gui::COLOR_NEUTRAL_PLAYER));
+    GidIndexEntry(m_players.back()->m_gid).player = m_players.back().get();
+
+    for (size_t p = 0; p < glob::game::NUM_PLAYERS; p++)
+    {
+        Eigen::Vector2f startPosition;
+        bool playerTooClose = false;
+        size_t maxIterCount = 0;
+        do
+        {
+            playerTooClose = false;
+            auto heading = m_gameRng.uniform_real_distribution<float>(0, 2.0 * static_cast<float>(M_PI));
+            auto radius = 0.8F * glob::game::BOARD_WIDTH.at(1);
+
+            startPosition = radius * Eigen::Vector2f{ std::cos(heading), std::sin(heading) };
+            for (size_t i = 1; i < m_players.size(); i++)
+            {
+                if ((m_players.at(i)->GetHeadquarterPosition() - startPosition).norm() < 0.8 * glob::game::BOARD_WIDTH.at(1))
+                {
+                    playerTooClose = true;
+                    break;
+                }
+            }
+            maxIterCount++;
+            if (maxIterCount > 100)
+            {
+                break;
+            }
+        } while (playerTooClose);
+
+        // Create Player
+        const auto& playerColor = glob::gui::COLOR_PLAYERS.at(p == 0 ? 5 : (p - 1) % glob::gui::COLOR_PLAYERS.size());
+        m_players.push_back(CreatePlayer(p, startPosition, playerColor));
+
+        GidIndexEntry(m_players.back()->m_gid).player = m_players.back().get();
+
+        // Tracks resource positions relative to player
+        m_itemsCloseToPlayer.push_back(0);
+
+        // Spawn Headquarters
+        auto hqHeading = m_gameRng.uniform_real_distribution<float>(0, 2.0F * static_cast<float>(M_PI));
+
+        m_players.back()->AddUnit(CreateHeadquarters(p, m_players.back().get(), GetNextGID(), startPosition, hqHeading));
+
+        if (m_players.back()->m_units.size() > 1) // HQ constructor adds units so the HQ actually gets added last
+        {
+            std::swap(m_players.back()->m_units.front(), m_players.back()->m_units.back());
+        }
+
+        for (uint8_t t = 0; t < ResourceType_COUNT; ++t)
+        {
+            // Calculate total available resources on the map
+            availableResources.at(t) = m_gameRng.uniform_real_distribution<float>(glob::resources::AMOUNT_RESOURCES_TOTAL.at(t).front(),
+                                                                                  glob::resources::AMOUNT_RESOURCES_TOTAL.at(t).back());
+
+            // Spawn resource in close proximity to headquaters
+            auto amount = m_gameRng.uniform_real_distribution<float>(glob::resources::AMOUNT_RESOURCES_PER_ENTITY.at(t).front(),
+                                                                     glob::resources::AMOUNT_RESOURCES_PER_ENTITY.at(t).back());
+            SpawnResource(static_cast<ResourceType>(t),
+                          static_cast<int>(amount),
+                          GetNewResourcePosition(startPosition, glob::resources::MIN_DISTANCE_RESOURCE_TO_HQ_LIMITED),
+                          static_cast<float>(M_PI / 180 * 0.0F));
+            availableResources.at(t) -= amount;
+        }
+    }
+
+    // Spawn resources till the total available amount is exhausted
+    while (std::any_of(availableResources.begin(), availableResources.end(), [](float amount) { return amount > 0; }))
+    {
+        for (uint8_t t = 0; t < ResourceType_COUNT; t++)
+        {
+            if (availableResources.at(t) > 0)
+            {
+                auto amount = m_gameRng.uniform_real_distribution<float>(glob::resources::AMOUNT_RESOURCES_PER_ENTITY.at(t).front(),
+                                                                         glob::resources::AMOUNT_RESOURCES_PER_ENTITY.at(t).back());
+                SpawnResource(static_cast<ResourceType>(t), static_cast<int>(amount), GetNewResourcePosition(), 0.0F);
+                availableResources.at(t) -= amount;
+            }
+        }
+    }
+}
+
+void World::UpdatePhased(float deltaTime)
+{
+    // Players think first, as they can spawn units (which then take part in this update)
+    for (const auto& player : m_players)
+    {
+        OOP_PROFILE_ZONE("Player think");
+        PlayerThink(*player, deltaTime);
+    }
+
+    m_phasedUnits.clear();
+    for (const auto& player : m_players)
+    {
+        for (const auto& unit : player->m_units)
+        {
+            m_phasedUnits.push_back(unit.get());
+        }
+    }
+    std::sort(m_phasedUnits.begin(), m_phasedUnits.end(), [](const Unit* lhs, const Unit* rhs) { return lhs->m_gid < rhs->m_gid; });
+
+    // Without random streams everything drawing from the shared user random number generator runs serially in the order
+    // of the global ids. Every unit gets a seed for its own generator, so that the Think phase does not depend on the thread count.
+    // The satellite measurements are therefore generated here for every unit instead of on their first use.
+    const bool randomStreams = glob::game::RANDOM_STREAMS;
+    if (!randomStreams)
+    {
+        OOP_PROFILE_ZONE("Satellite measurements");
+        m_thinkSeeds.resize(m_phasedUnits.size());
+        for (size_t i = 0; i < m_phasedUnits.size(); i++)
+        {
+            if (m_phasedUnits[i]->m_parent->m_gid) // Neutral units dont need satellites
+            {
+                m_phasedUnits[i]->UpdateSatelliteMeasurements();
+            }
+            m_thinkSeeds[i] = UserRng().uniform_int_distribution<uint64_t>();
+        }
+    }
+
+    if (!m_thinkPool || m_thinkPool->ThreadCount() != std::max(glob::game::THINK_THREADS, size_t{ 1 }))
+    {
+        m_thinkPool = std::make_unique<ThreadPool>(glob::game::THINK_THREADS);
+    }
+
+    // The regeneration, healing and reloading change the health, which the other units read in their scans. It is therefore
+    // finished for all units before the first one thinks, so that the scans do not depend on the thread count
+    {
+        OOP_PROFILE_ZONE("Before think");
+        for (auto* unit : m_phasedUnits)
+        {
+            if (unit->m_parent->m_isAlive)
+            {
+                unit->UpdateBeforeThink(deltaTime);
+            }
+        }
+    }
+
+    // ----------------------------------------------- Think phase -----------------------------------------------
+    // The units only read the state after the regeneration and healing above and write to themselves
+    m_thinkPool->ParallelFor(m_phasedUnits.size(), [this, deltaTime, randomStreams](size_t begin, size_t end) {
+        OOP_PROFILE_ZONE("Think phase");
+        Scope scope(*this);
+
+        for (size_t i = begin; i < end; i++)
+        {
+            auto* unit = m_phasedUnits[i];
+            unit->m_unitScanOutdated = true;
+            if (unit->m_parent->m_gid) // Neutral units dont need resources (for now) and satellites
+            {
+                unit->m_resourceScanOutdated = true;
+                if (randomStreams)
+                {
+                    unit->m_satellitePacketsOutdated = true;
+                }
+            }
+            if (!unit->m_parent->m_isAlive)
+            {
+                continue;
+            }
+
+            RandomNumberGenerator seededRng;
+            if (!randomStreams)
+            {
+                seededRng.useSeedInsteadOfSystemTime = true;
+                seededRng.seed = m_thinkSeeds[i];
+                seededRng.reset();
+            }
+            UserRngBinding rngBinding(randomStreams ? UserRng(unit->m_gid, RandomPurpose_Think) : seededRng);
+
+            unit->Think(deltaTime);
+        }
+        TickArena::ForThread().Reset();
+    });
+
+    // ---------------------------------------------- Commit phase -----------------------------------------------
+    OOP_PROFILE_ZONE("Commit phase");
+    // A move only changes the position of the unit itself, so all moves are integrated in one pass first. The other
+    // actions are applied afterwards in the order of the global ids and see the positions after the moves
+    m_moveIntegrator.Clear();
+    for (auto* unit : m_phasedUnits)
+    {
+        if (unit->m_parent->m_isAlive && unit->m_action == Unit::Action_Move)
+        {
+            m_moveIntegrator.Add(*unit);
+        }
+    }
+    m_moveIntegrator.Advance(deltaTime);
+
+    for (auto* unit : m_phasedUnits)
+    {
+        if (!unit->m_parent->m_isAlive)
+        {
+            continue;
+        }
+        if (unit->m_action == Unit::Action_Move)
+        {
+            unit->m_actionTooltip = Unit::Action_Move;
+            unit->m_action = Unit::Action_None;
+        }
+        else
+        {
+            unit->ApplyAction(deltaTime);
+        }
+    }
+}
+
+void World::RemoveDeadUnits()
+{
+    OOP_PROFILE_ZONE("Cleanup units");
+
+    for (auto& player : m_players)
+    {
+        auto& units = player->m_units;
+        for (const auto& unit : units)
+        {
+            if (unit->m_currentHealth <= 0)
+            {
+                m_gidIndex.at(unit->m_gid).unit = nullptr;
+            }
+        }
+        if (!units.empty() && units.front()->m_currentHealth <= 0 // HQ
+            && player->m_gid != 0)                                // and not neutral player
+        {
+            player->m_isAlive = false;
+        }
+
+        // Units stay in their order, as it is the update order and the headquarters is the first one
+        auto unitsEnd = std::remove_if(units.begin(), units.end(), [](const auto& unit) { return unit->m_currentHealth <= 0; });
+        if (unitsEnd != units.end())
+        {
+            player->m_unitsLost += static_cast<size_t>(std::distance(unitsEnd, units.end()));
+            units.erase(unitsEnd, units.end());
+            m_neighbourListsOutdated = true; // The lists point to the removed units
+        }
+    }
+}
+
+void World::RemoveDepletedResources()
+{
+    OOP_PROFILE_ZONE("Cleanup resources");
+
+    if (m_resources.EraseIf([](const Resource& resource) { return resource.m_amount == 0; }))
+    {
+        RebuildResourceGrid(); // Indices in the grid changed
+    }
+}
+
+void World::RemoveSatellitesOffBoard()
+{
+    OOP_PROFILE_ZONE("Cleanup satellites");
+
+    m_satellites.EraseIf([this](const Satellite& satellite) {
+        const Eigen::Vector2f pos = satellite.Position(m_satelliteTime);
+        return pos.x() < glob::game::BOARD_WIDTH.at(0) || pos.x() > glob::game::BOARD_WIDTH.at(1)
+               || pos.y() < glob::game::BOARD_HEIGHT.at(0) || pos.y() > glob::game::BOARD_HEIGHT.at(1);
+    });
+}
+
+void World::CheckWinCondition()
+{
+    OOP_PROFILE_ZONE("Win condition");
+
+    if (!m_gameFinished)
+    {
+        if (m_resources.empty()                                   // All resources collected
+            || m_gameTime >= static_cast<float>(m_gameTimeLimit)) // Game time exceeded
+        {
+            bool unitCarryingResources = false;
+            if (m_gameTime < static_cast<float>(m_gameTimeLimit)) // only check if units carrying resources if within game time
+            {
+                for (const auto& player : m_players)
+                {
+                    for (const auto& unit : player->m_units)
+                    {
+                        if (unit->m_resourcesCarried.second)
+                        {
+                            unitCarryingResources = true;
+                            break;
+                        }
+                    }
+                    if (unitCarryingResources)
+                    {
+                        break;
+                    }
+                }
+            }
+            if (!unitCarryingResources) // No unit carrying resources
+            {
+                m_gameRunning = false;
+                m_gameFinished = 2;
+
+                size_t winningPlayerIndex = 0;
+                size_t winningResSum = 0;
+                for (size_t p = 1; p < m_players.size(); ++p)
+                {
+                    size_t resSum = 0;
+                    for (uint8_t resType = 0; resType < ResourceType_COUNT; ++resType)
+                    {
+                        resSum += m_players.at(p)->m_collectedResourcesTotal.at(resType);
+                    }
+                    if (resSum > winningResSum)
+                    {
+                        winningResSum = resSum;
+                        winningPlayerIndex = p;
+                    }
+                }
+                m_winningPlayerColor = m_players.at(winningPlayerIndex)->GetColor();
+                m_winningPlayerGid = m_players.at(winningPlayerIndex)->m_gid;
+            }
+        }
+
+        size_t playersAlive = 0;
+        for (const auto& player : m_players)
+        {
+            if (!player->m_gid) // Neutral player
+            {
+                continue;
+            }
+            if (size_t unitCnt = player->m_units.size() - 1; // Player has only one unit left (has to be HQ, otherwise already dead)
+                unitCnt == 0)
+            {
+                for (uint8_t resType = 0; resType < ResourceType_COUNT; ++resType) // Not enough resources to build new unit
+                {
+                    if (player->m_resources.at(resType) < static_cast<size_t>(glob::units::ROBOT_COSTS.at(resType)))
+                    {
+                        player->m_isAlive = false;
+                        break;
+                    }
+                }
+            }
+
+            if (player->m_isAlive)
+            {
+                playersAlive += 1;
+            }
+        }
+        if (playersAlive == 0) // Single player (game lost)
+        {
+            m_gameRunning = false;
+            m_gameFinished = 2;
+        }
+        else if (glob::game::ENABLE_PVP                                                 // PVP enabled
+                 && m_players.size() > 2                                                // Multiplayer
+                 && playersAlive == 1                                                   // Only one player alive
+                 && (!glob::game::NEUTRAL_UNITS || m_players.front()->m_units.empty())) // No neutral units alive
+        {
+            m_gameRunning = false;
+            m_gameFinished = 2;
+            for (const auto& player : m_players)
+            {
+                if (!player->m_gid) // Neutral player
+                {
+                    continue;
+                }
+                if (player->m_isAlive)
+                {
+                    m_winningPlayerColor = player->GetColor();
+                    m_winningPlayerGid = player->m_gid;
+                }
+            }
+        }
+    }
+}
+
+void World::Update(float deltaTime)
+{
+    OOP_PROFILE_ZONE("World update");
+    Scope scope(*this);
+#ifdef OOP_PROFILER
+    const uint64_t allocationCount = AllocationCounter::Count();
+#endif
+
+    {
+        OOP_PROFILE_ZONE("Satellite spawn");
+        while (m_satellites.size() < glob::positioning::NUM_SAT)
+        {
+            auto [pos, heading] = GetNewSatellitePositionAndHeading();
+            SpawnSatellite(pos, heading);
+        }
+    }
+
+    m_attackOccurred = false;
+
+    if (!m_gameRunning && !m_changedSinceUpdate)
+    {
+        return; // The last paused update is still up to date
+    }
+    m_changedSinceUpdate = false;
+
+    // The players think before their units are updated. Their reads of the scans and packets therefore show the state
+    // at the start of this update, no matter whether a unit already read them in its last Think
+    for (const auto& player : m_players)
+    {
+        for (const auto& unit : player->m_units)
+        {
+            unit->MarkScansOutdated();
+        }
+    }
+
+    if (m_gameRunning)
+    {
+        // The satellites move on their own, as their positions only depend on the game time
+        m_satelliteTime = m_gameTime + deltaTime;
+    }
+
+    {
+        OOP_PROFILE_ZONE("Neighbour lists");
+        UpdateNeighbourLists(deltaTime);
+    }
+
+    if (m_gameRunning && glob::game::PHASED_UPDATE)
+    {
+        UpdatePhased(deltaTime);
+    }
+    else
+    {
+        for (const auto& player : m_players)
+        {
+            if (m_gameRunning)
+            {
+                OOP_PROFILE_ZONE("Player think");
+                PlayerThink(*player, deltaTime);
+            }
+            for (const auto& unit : player->m_units)
+            {
+                {
+                    OOP_PROFILE_ZONE("Unit scans");
+                    unit->UpdateAlways();
+                }
+                if (m_gameRunning && player->m_isAlive)
+                {
+                    OOP_PROFILE_ZONE("Unit update");
+                    unit->Update(deltaTime);
+                }
+            }
+        }
+    }
+
+    // --------------------------------------- Cleanup obsolete objects ------------------------------------------
+    RemoveDeadUnits();
+    RemoveDepletedResources();
+    RemoveSatellitesOffBoard();
+
+    // --------------------------------------------- Win condition -----------------------------------------------
+    CheckWinCondition();
+
+    // The scratch data of the update is not needed anymore
+    TickArena::ForThread().Reset();
+
+#ifdef OOP_PROFILER
+    size_t unitCount = 0;
+    size_t packetCount = 0;
+    size_t unitScanCandidates = 0;
+    size_t resourceScanCandidates = 0;
+    for (const auto& player : m_players)
+    {
+        unitCount += player->m_units.size();
+        for (const auto& unit : player->m_units)
+        {
+            packetCount += unit->m_satellitePacketsOutdated ? 0 : unit->m_satellitePackets.Size();
+            unitScanCandidates += unit->m_unitScanOutdated ? 0 : unit->m_unitScanCandidates;
+            resourceScanCandidates += unit->m_resourceScanOutdated ? 0 : unit->m_resourceScanCandidates;
+        }
+    }
+    OOP_PROFILE_COUNTER("Units", unitCount);
+    OOP_PROFILE_COUNTER("Resources", m_resources.size());
+    OOP_PROFILE_COUNTER("Satellites", m_satellites.size());
+    OOP_PROFILE_COUNTER("Satellite packets", packetCount);
+    OOP_PROFILE_COUNTER("Unit scan candidates", unitScanCandidates);
+    OOP_PROFILE_COUNTER("Resource scan candidates", resourceScanCandidates);
+    OOP_PROFILE_COUNTER("Heap allocations", AllocationCounter::Count() - allocationCount);
+#endif
+
+    if (m_gameRunning)
+    {
+        m_gameTime += deltaTime;
+        m_tick++;
+    }
+}
+
+} // namespace oop::internal
\ No newline at end of file
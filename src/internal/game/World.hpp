@@ -0,0 +1,361 @@
+/// @file World.hpp
+/// @brief State of a single match, so that several matches can be simulated in one process
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "player/PlayerBase.hpp"
+#include "resources/Resource.hpp"
+#include "positioning/Satellite.hpp"
+#include "units/MoveIntegrator.hpp"
+#include "units/UnitPool.hpp"
+#include "internal/helper/Color.hpp"
+#include "internal/helper/RandomNumberGenerator.hpp"
+#include "internal/helper/SlotMap.hpp"
+#include "internal/helper/SpatialGrid.hpp"
+#include "internal/helper/ThreadPool.hpp"
+
+namespace oop::internal
+{
+
+class Unit;
+
+/// @brief Owns the complete state of a match including its random number generators.
+///
+/// The game objects find the world they belong to with World::Current(), which is bound per thread by a World::Scope.
+/// OnStart() and Update() bind the world themselves, so worlds can be simulated on different threads at the same time.
+///
+/// With glob::game::PHASED_UPDATE an update first regenerates, heals and reloads all units, then lets all units think in
+/// parallel on the same state, then moves all moving units at once and applies the other actions in the order of the
+/// global ids. The result is identical for every amount of threads and does not depend on the order of the players.
+class World
+{
+  public:
+    /// @brief Default constructor
+    World() = default;
+    /// @brief Destructor
+    ~World() = default;
+    /// @brief Copy constructor
+    World(const World&) = delete;
+    /// @brief Move constructor
+    World(World&&) = delete;
+    /// @brief Copy assignment operator
+    World& operator=(const World&) = delete;
+    /// @brief Move assignment operator
+    World& operator=(World&&) = delete;
+
+    /// @brief Binds a world to the current thread for the lifetime of the scope
+    class Scope
+    {
+      public:
+        /// @brief Constructor
+        /// @param[in] world World to bind
+        explicit Scope(World& world);
+        /// @brief Destructor, which binds the previous world again
+        ~Scope();
+        /// @brief Copy constructor
+        Scope(const Scope&) = delete;
+        /// @brief Move constructor
+        Scope(Scope&&) = delete;
+        /// @brief Copy assignment operator
+        Scope& operator=(const Scope&) = delete;
+        /// @brief Move assignment operator
+        Scope& operator=(Scope&&) = delete;
+
+      private:
+        /// World which was bound before this scope
+        World* m_previous;
+    };
+
+    /// @brief World bound to the current thread. Only valid inside a World::Scope
+    [[nodiscard]] static World& Current();
+
+    /// @brief Resets the world and spawns a new match
+    void OnStart();
+
+    /// @brief Update the world for the time passed
+    /// @param[in] deltaTime Time since last update
+    void Update(float deltaTime);
+
+  private:
+    /// @brief Get the next Global Id
+    size_t GetNextGID();
+
+    /// @brief Entities which can be found by their global id (only one of them is set)
+    struct GidEntry
+    {
+        /// Unit with the global id (cleared when the unit is removed)
+        Unit* unit = nullptr;
+        /// Player with the global id
+        PlayerBase* player = nullptr;
+        /// Resource with the global id (resolves to nullptr after the resource is removed)
+        SlotMap<Resource>::Handle resource;
+        /// Satellite with the global id (resolves to nullptr after the satellite is removed)
+        SlotMap<Satellite>::Handle satellite;
+    };
+
+    /// @brief Entry of the global id index, which gets added if it does not exist yet
+    /// @param[in] gid Global id of the entity
+    GidEntry& GidIndexEntry(size_t gid);
+
+    /// @brief Unit with the global id
+    /// @param[in] gid Global id of the unit
+    /// @return The unit or nullptr if there is no unit with this id (anymore)
+    [[nodiscard]] Unit* FindUnit(size_t gid) const;
+
+    /// @brief Resource with the global id
+    /// @param[in] gid Global id of the resource
+    /// @return The resource or nullptr if there is no resource with this id (anymore)
+    [[nodiscard]] Resource* FindResource(size_t gid);
+
+    /// @brief Player with the global id
+    /// @param[in] gid Global id of the player (the neutral player has 0)
+    /// @return The player or nullptr if there is no player with this id
+    [[nodiscard]] PlayerBase* FindPlayer(size_t gid) const;
+
+    /// @brief Adds a resource and inserts it into the resource grid and the global id index
+    /// @param[in] type Type of the resource
+    /// @param[in] amount Amount of resources contained
+    /// @param[in] position Position of the resource
+    /// @param[in] heading Heading of the resource
+    void SpawnResource(ResourceType type, int amount, const Eigen::Vector2f& position, float heading);
+
+    /// @brief Adds a satellite and inserts it into the global id index
+    /// @param[in] position Position of the satellite
+    /// @param[in] heading Heading of the satellite
+    void SpawnSatellite(const Eigen::Vector2f& position, float heading);
+
+    /// @brief Rebuilds the global id index from the players, units, resources and satellites
+    void RebuildGidIndex();
+
+    /// @brief Creates the player of a team (needs a bound world)
+    /// @param[in] index Index of the player without the neutral player, which selects the team
+    /// @param[in] position Position of the headquarters
+    /// @param[in] color Color of the player
+    static std::shared_ptr<PlayerBase> CreatePlayer(size_t index, const Eigen::Vector2f& position, const Color& color);
+
+    /// @brief Creates the headquarters of a team in the unit pool (needs a bound world)
+    /// @param[in] index Index of the player without the neutral player, which selects the team
+    /// @param[in] parent Player who owns the headquarters
+    /// @param[in] gid Global id of the headquarters
+    /// @param[in] position Position of the headquarters
+    /// @param[in] heading Heading of the headquarters
+    UnitPtr CreateHeadquarters(size_t index, PlayerBase* parent, size_t gid, const Eigen::Vector2f& position, float heading);
+
+    /// @brief Creates a robot of a team in the unit pool (needs a bound world)
+    /// @param[in] index Index of the player without the neutral player, which selects the team
+    /// @param[in] parent Player who owns the robot
+    /// @param[in] position Position of the robot
+    /// @param[in] heading Heading of the robot
+    UnitPtr CreateRobot(size_t index, PlayerBase* parent, const Eigen::Vector2f& position, float heading);
+
+    /// @brief Replaces the user random number generator of the current thread for the lifetime of the object
+    class UserRngBinding
+    {
+      public:
+        /// @brief Constructor
+        /// @param[in] rng Random number generator to use
+        explicit UserRngBinding(RandomNumberGenerator& rng);
+        /// @brief Destructor, which binds the previous generator again
+        ~UserRngBinding();
+        /// @brief Copy constructor
+        UserRngBinding(const UserRngBinding&) = delete;
+        /// @brief Move constructor
+        UserRngBinding(UserRngBinding&&) = delete;
+        /// @brief Copy assignment operator
+        UserRngBinding& operator=(const UserRngBinding&) = delete;
+        /// @brief Move assignment operator
+        UserRngBinding& operator=(UserRngBinding&&) = delete;
+
+      private:
+        /// Random number generator which was bound before
+        RandomNumberGenerator* m_previous;
+    };
+
+    /// @brief Random number generator for user triggered game logic (separate one while the game is paused)
+    RandomNumberGenerator& UserRng();
+
+    /// @brief Random number generator for user triggered game logic of an entity
+    /// @param[in] gid Global id of the entity
+    /// @param[in] purpose Purpose of the numbers
+    /// @return The stream of the entity with glob::game::RANDOM_STREAMS, otherwise UserRng()
+    RandomNumberGenerator& UserRng(size_t gid, RandomPurpose purpose);
+
+    /// @brief Lets the player think, with its own random number stream if enabled
+    /// @param[in] player Player to think
+    /// @param[in] deltaTime Time since last update
+    void PlayerThink(PlayerBase& player, float deltaTime);
+
+    /// @brief Get a new resource position
+    /// @param[in] maxDistance Maximum rectangular distance the object should have to the center position
+    Eigen::Vector2f GetNewResourcePosition(const Eigen::Vector2f& center = { 0, 0 }, float maxDistance = -1.0F);
+
+    /// @brief Get a new satellite position and heading
+    std::pair<Eigen::Vector2f, float> GetNewSatellitePositionAndHeading();
+
+    /// @brief Entry of the unit grid and the neighbour lists
+    struct UnitGridEntry
+    {
+        /// Position in the order of iterating over all players and their units (player index in the upper 32 bit, unit index in the lower)
+        uint64_t order = 0;
+        /// The unit
+        const Unit* unit = nullptr;
+    };
+
+    /// @brief Updates the players and units in a parallel Think phase and a serial commit phase
+    /// @param[in] deltaTime Time since last update
+    void UpdatePhased(float deltaTime);
+
+    /// @brief Removes the units without health and marks players as dead whose headquarters got destroyed
+    void RemoveDeadUnits();
+
+    /// @brief Removes the resources which got collected completely
+    void RemoveDepletedResources();
+
+    /// @brief Removes the satellites which left the board
+    void RemoveSatellitesOffBoard();
+
+    /// @brief Finishes the game if all resources are collected, the time is up or only one player is left
+    void CheckWinCondition();
+
+    /// @brief Rebuilds the resource grid from the list of resources
+    void RebuildResourceGrid();
+
+    /// @brief Rebuilds the neighbour lists if a unit could have moved further than half the skin since the last rebuild
+    /// till the end of this update, or if units were spawned or removed
+    /// @param[in] deltaTime Time the units can move in this update
+    void UpdateNeighbourLists(float deltaTime);
+
+    /// @brief Rebuilds the unit grid and the neighbour lists of all units from the current unit positions
+    /// @param[in] deltaTime Time the units can move in this update
+    void RebuildNeighbourLists(float deltaTime);
+
+    /// @brief Storage of all units, one slab per unit type (declared before the players, as it has to outlive their units)
+    UnitPool m_unitPool;
+
+    /// @brief List of all players (the neutral player is the first one)
+    std::vector<std::shared_ptr<PlayerBase>> m_players;
+
+    /// @brief All resources spawned on the map (the order changes when resources get removed, the global ids give the spawn order)
+    SlotMap<Resource> m_resources;
+
+    /// @brief All satellites spawned on the map (the order changes when satellites get removed)
+    SlotMap<Satellite> m_satellites;
+
+    /// @brief Amount of resources close to the HQ of each player (index shifted by one, as the neutral player has no HQ)
+    std::vector<int> m_itemsCloseToPlayer;
+
+    /// @brief Global Id which gets assigned next
+    size_t m_currentGid = 1;
+
+    /// @brief Entities of every global id assigned so far (the index is the global id)
+    std::vector<GidEntry> m_gidIndex;
+
+    /// @brief Grid over the indices of all resources. Depleted resources stay inside till the list gets cleaned up
+    SpatialGrid<size_t> m_resourceGrid;
+
+    /// @brief Distance added to the scan ranges of the neighbour lists [m]. Larger skins rebuild less often but filter more candidates
+    static constexpr float NEIGHBOUR_SKIN = 2.0F;
+
+    /// @brief Grid over all units (sized by the largest scan range plus the skin), used to build the neighbour lists
+    SpatialGrid<UnitGridEntry> m_unitGrid;
+
+    /// @brief Skin of the current neighbour lists (at least twice the distance the units can move in one update)
+    float m_neighbourSkin = 0.0F;
+
+    /// @brief Units within the scan range plus the skin of every unit when the lists were built, sorted by their order.
+    /// The lists of all units are stored one after another, in the order of iterating over all players and their units
+    std::vector<UnitGridEntry> m_neighbours;
+
+    /// @brief Index of the first entry of every neighbour list in m_neighbours (one more than units in the lists)
+    std::vector<size_t> m_neighbourOffsets;
+
+    /// @brief Positions of the units when the neighbour lists were built (same order as the lists)
+    std::vector<Eigen::Vector2f> m_neighbourReferencePositions;
+
+    /// @brief Amount of units per player which have a neighbour list (units spawned afterwards have none)
+    std::vector<size_t> m_neighbourListUnitCount;
+
+    /// @brief Flag whether units were removed or replaced since the neighbour lists were built
+    bool m_neighbourListsOutdated = true;
+
+    /// @brief Units of the current phased update, sorted by their global id
+    std::vector<Unit*> m_phasedUnits;
+
+    /// @brief Seeds of the random number generators of the units in the Think phase (same order as m_phasedUnits)
+    std::vector<uint64_t> m_thinkSeeds;
+
+    /// @brief Threads running the Think phase of the phased update (created on first use)
+    std::unique_ptr<ThreadPool> m_thinkPool;
+
+    /// @brief Moves the units of the Commit phase of the phased update
+    MoveIntegrator m_moveIntegrator;
+
+    /// @brief Time of this run
+    float m_gameTime = 0.0F;
+
+    /// @brief Game time the satellites are at. During an update it is already the time at the end of the update
+    float m_satelliteTime = 0.0F;
+
+    /// @brief Amount of updates performed while the game was running
+    uint64_t m_tick = 0;
+
+    /// @brief Game time limit in seconds
+    int32_t m_gameTimeLimit = 3600;
+
+    /// @brief Flag whether the game is running
+    bool m_gameRunning = false;
+
+    /// @brief Flag whether the game is finished
+    int m_gameFinished = 0;
+
+    /// @brief Color of the player who won the round (transparent if nobody won)
+    Color m_winningPlayerColor{ 0, 0, 0, 0 };
+
+    /// @brief Global Id of the player who won the round (0 if nobody won)
+    size_t m_winningPlayerGid = 0;
+
+    /// @brief Flag whether a unit attacked another unit during the last update
+    bool m_attackOccurred = false;
+
+    /// @brief Flag whether the world was changed by something else than an update since the last update (reset,
+    /// snapshot, GUI command). Nothing moves while the game is paused, so paused updates are skipped while it is not set
+    bool m_changedSinceUpdate = true;
+
+    /// @brief Random number generator for game logic
+    RandomNumberGenerator m_gameRng;
+
+    /// @brief Random number generator for user triggered game logic while the game is running
+    RandomNumberGenerator m_userRng;
+
+    /// @brief Random number generator for user triggered game logic while the game is paused
+    RandomNumberGenerator m_userRngPause;
+
+    friend class GameState;
+    friend class SimulationThread;
+    friend struct RenderState;
+    friend class GameApplication;
+    friend class HeadlessApplication;
+    friend class Tournament;
+    friend class Replay;
+    friend class Snapshot;
+    friend class Benchmarks;
+    friend class ControlPanel;
+    friend class GlobalWindows;
+    friend class RandomNumberGenerator;
+    friend class PlayerBase;
+    friend class Unit;
+    friend class RobotBase;
+    friend class HeadquartersBase;
+    friend class Virus;
+    friend class Resource;
+    friend class Satellite;
+};
+
+} // namespace oop::internal
@@ -8,7 +8,7 @@
 namespace oop::internal
 {
 
-NeutralPlayer::NeutralPlayer(const ImColor& color)
+NeutralPlayer::NeutralPlayer(const Color& color)
     : internal::PlayerBase(0, Eigen::Vector2f{}, color)
 {
     // Add starting units
@@ -28,7 +28,7 @@ NeutralPlayer::NeutralPlayer(const ImColor& color)
 
         startPosition += Eigen::Vector2f{ glob::game::BOARD_WIDTH.at(0), glob::game::BOARD_HEIGHT.at(0) };
 
-        AddUnit(std::make_shared<Virus>(this, startPosition, 0.0F));
+        AddUnit(Pool().Create<Virus>(this, startPosition, 0.0F));
     }
 
     m_resources.fill(0);
@@ -13,7 +13,7 @@ class NeutralPlayer : public internal::PlayerBase
 {
   public:
     /// @brief Default Constructor
-    explicit NeutralPlayer(const ImColor& color);
+    explicit NeutralPlayer(const Color& color);
 
     /// @brief Destructor
     ~NeutralPlayer() override = default;
@@ -1,11 +1,8 @@
 #include "Virus.hpp"
 
 #include <spdlog/spdlog.h>
-#include <implot.h>
-#include "internal/gui/helper/ImPlotHelper.hpp"
-#include "internal/GameApplication.hpp"
 #include "internal/game/player/PlayerBase.hpp"
-#include "internal/game/GameState.hpp"
+#include "internal/game/World.hpp"
 #include "internal/game/Settings.hpp"
 #include "internal/helper/RandomNumberGenerator.hpp"
 
@@ -13,8 +10,9 @@ namespace oop::internal
 {
 
 Virus::Virus(PlayerBase* parent, const Eigen::Vector2f& position, float heading)
-    : Unit(parent, GameState::GetNextGID(), position, heading)
+    : Unit(parent, World::Current().GetNextGID(), position, heading)
 {
+    m_kind = Kind_Virus;
     m_maxHealth = glob::units::ATTR_VIRUS_HEALTH;
     m_currentHealth = m_maxHealth;
     m_speed = glob::units::ATTR_VIRUS_SPEED;
@@ -46,66 +44,26 @@ std::string Virus::GetUnitTypeName() const
     return "Virus";
 }
 
-bool Virus::IsHeadquarters() const
-{
-    return false;
-}
-
-void Virus::Draw() const
-{
-    using internal::gui::helper::PlotToPixel;
-
-    Unit::Draw();
-
-    auto drawBackgroundShape = [this](const ImColor& color) {
-        ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(m_pos.x(), m_pos.y()),
-                                                   0.7F * static_cast<float>(PlotToPixel(GetDrawSize())), color);
-    };
-
-    if (std::holds_alternative<std::shared_ptr<const Unit>>(GameState::selectedObject)
-        && std::get<std::shared_ptr<const Unit>>(GameState::selectedObject)
-        && std::get<std::shared_ptr<const Unit>>(GameState::selectedObject)->m_gid == m_gid)
-    {
-        drawBackgroundShape(glob::gui::COLOR_SELECTED);
-    }
-    else if (ImPlot::IsPlotHovered()
-             && (m_pos - Eigen::Vector2f{ ImPlot::GetPlotMousePos().x, ImPlot::GetPlotMousePos().y })
-                        .norm()
-                    <= GetDrawSize() * glob::gui::HOVER_OBJECT_SIZE_MODIFIER)
-    {
-        drawBackgroundShape(glob::gui::COLOR_HOVERED);
-    }
-
-    Eigen::Vector2f upperLeft = m_pos + Eigen::Vector2f{ -0.5F * GetDrawSize(), 0.5F * GetDrawSize() };
-    Eigen::Vector2f lowerRright = m_pos + Eigen::Vector2f{ 0.5F * GetDrawSize(), -0.5F * GetDrawSize() };
-    ImPlot::GetPlotDrawList()->AddImage(GameApplication::virusTexture,
-                                        ImPlot::PlotToPixels(upperLeft.x(), upperLeft.y()),
-                                        ImPlot::PlotToPixels(lowerRright.x(), lowerRright.y()));
-
-    DrawOverlay();
-}
-
 float Virus::GetDrawSize() const
 {
     return 3.0F;
 }
 
-void Virus::Update(float deltaTime)
+void Virus::UpdateBeforeThink(float deltaTime)
 {
     m_currentHealth += glob::units::ATTR_VIRUS_HEALTH_REGENERATION * deltaTime;
     m_currentHealth = std::min(m_currentHealth, m_maxHealth);
 
-    Unit::Update(deltaTime);
+    Unit::UpdateBeforeThink(deltaTime);
+}
+
+void Virus::ApplyAction(float deltaTime)
+{
+    Unit::ApplyAction(deltaTime);
 
     if (m_action == Action_Move)
     {
-        m_pos.x() = static_cast<float>(std::clamp(m_pos.x() + m_speed * deltaTime * std::cos(M_PI_2 + m_heading),
-                                                  glob::game::BOARD_WIDTH.at(0),
-                                                  glob::game::BOARD_WIDTH.at(1)));
-
-        m_pos.y() = static_cast<float>(std::clamp(m_pos.y() + m_speed * deltaTime * std::sin(M_PI_2 + m_heading),
-                                                  glob::game::BOARD_HEIGHT.at(0),
-                                                  glob::game::BOARD_HEIGHT.at(1)));
+        ApplyMove(deltaTime); // Viruses never carry resources, so they move with their full speed
     }
 
     m_action = Action_None;
@@ -46,18 +46,16 @@ class Virus : public Unit
     /// @brief Get the type of the unit
     [[nodiscard]] std::string GetUnitTypeName() const final;
 
-    /// @brief Checks whether the unit is the HQ
-    [[nodiscard]] bool IsHeadquarters() const final;
-
-    /// @brief Draw the unit
-    void Draw() const final;
-
     /// The size of a robot
     [[nodiscard]] float GetDrawSize() const final;
 
-    /// @brief Updates the unit state
+    /// @brief Updates the state of only this unit before it thinks (regeneration, reloading, healing)
     /// @param[in] deltaTime Time passed since last update
-    void Update(float deltaTime) final;
+    void UpdateBeforeThink(float deltaTime) final;
+
+    /// @brief Applies the planned action to the world
+    /// @param[in] deltaTime Time passed since last update
+    void ApplyAction(float deltaTime) final;
 
     /// @brief Make decisions
     /// @param[in] deltaTime Time passed since last update
@@ -81,6 +79,8 @@ class Virus : public Unit
 
     Eigen::Vector2f m_targetPos{ 0.0, 0.0 };
     size_t m_targetGid = 0;
+
+    friend class Snapshot;
 };
 
 } // namespace oop::internal
@@ -1,7 +1,7 @@
 #include "PlayerBase.hpp"
 
 #include "spdlog/spdlog.h"
-#include "internal/game/GameState.hpp"
+#include "internal/game/World.hpp"
 #include "internal/game/Settings.hpp"
 #include "internal/game/units/Unit.hpp"
 
@@ -10,10 +10,10 @@
 namespace oop::internal
 {
 
-PlayerBase::PlayerBase(const Eigen::Vector2f& position, const ImColor& color)
-    : PlayerBase(GameState::GetNextGID(), position, color) {}
+PlayerBase::PlayerBase(const Eigen::Vector2f& position, const Color& color)
+    : PlayerBase(World::Current().GetNextGID(), position, color) {}
 
-PlayerBase::PlayerBase(size_t gid, Eigen::Vector2f position, const ImColor& color)
+PlayerBase::PlayerBase(size_t gid, Eigen::Vector2f position, const Color& color)
     : m_gid(gid), m_hqPosition(std::move(position)), m_color(color), m_resources(glob::resources::STARTING_RESOURCES) {}
 
 // ###########################################################################################################
@@ -30,7 +30,7 @@ const std::string& PlayerBase::GetName() const
     return m_name;
 }
 
-ImColor PlayerBase::GetColor() const
+Color PlayerBase::GetColor() const
 {
     return m_color;
 }
@@ -55,6 +55,15 @@ size_t PlayerBase::GetHeadquarterGid() const
 // ###########################################################################################################
 
 void PlayerBase::SpawnUnit(const std::shared_ptr<Unit>& unit)
+{
+    TrySpawn(Pool().Adopt(unit));
+}
+
+// ###########################################################################################################
+//                                      Private content (inaccessible)
+// ###########################################################################################################
+
+bool PlayerBase::TrySpawn(UnitPtr unit)
 {
     auto resCosts = unit->GetUnitCosts();
 
@@ -63,7 +72,7 @@ void PlayerBase::SpawnUnit(const std::shared_ptr<Unit>& unit)
         if (resCosts.at(resType) > m_resources.at(resType))
         {
             spdlog::warn("Player {} can't spawn unit because not enough {}", m_gid, Resource::GetTypeName(static_cast<ResourceType>(resType)));
-            return;
+            return false;
         }
     }
 
@@ -75,24 +84,27 @@ void PlayerBase::SpawnUnit(const std::shared_ptr<Unit>& unit)
 
     unit->ApplyUnitAttributeModifiers();
 
-    auto heading = RandomNumberGenerator::userRngGenerator().uniform_real_distribution<float>(0, 2.0F * static_cast<float>(M_PI));
+    auto heading = RandomNumberGenerator::userRngGenerator(unit->m_gid, RandomPurpose_Spawn).uniform_real_distribution<float>(0, 2.0F * static_cast<float>(M_PI));
     Eigen::Vector2f position = m_hqPosition + 3.0F * Eigen::Vector2f{ std::cos(M_PI_2 + heading), std::sin(M_PI_2 + heading) };
 
-    unit->m_heading = heading;
+    unit->AssignHeading(heading);
     unit->m_pos = position;
 
     spdlog::info("Unit [{}] spawned with heading {}", m_gid, heading * 180 / M_PI);
 
-    AddUnit(unit);
+    AddUnit(std::move(unit));
+    return true;
 }
 
-// ###########################################################################################################
-//                                      Private content (inaccessible)
-// ###########################################################################################################
+void PlayerBase::AddUnit(UnitPtr unit)
+{
+    World::Current().GidIndexEntry(unit->m_gid).unit = unit.get();
+    m_units.push_back(std::move(unit));
+}
 
-void PlayerBase::AddUnit(const std::shared_ptr<Unit>& unit)
+UnitPool& PlayerBase::Pool()
 {
-    m_units.push_back(unit);
+    return World::Current().m_unitPool;
 }
 
 } // namespace oop::internal
\ No newline at end of file
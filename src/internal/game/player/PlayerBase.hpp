@@ -9,10 +9,12 @@
 #include <array>
 #include <vector>
 #include <memory>
-
-#include <imgui.h>
+#include <string>
+#include <utility>
 
 #include "internal/game/resources/Resource.hpp"
+#include "internal/game/units/UnitPool.hpp"
+#include "internal/helper/Color.hpp"
 
 namespace oop::internal
 {
@@ -23,10 +25,10 @@ class PlayerBase
 {
   public:
     /// @brief Constructor
-    PlayerBase(const Eigen::Vector2f& position, const ImColor& color);
+    PlayerBase(const Eigen::Vector2f& position, const Color& color);
 
     /// @brief Constructor
-    PlayerBase(size_t gid, Eigen::Vector2f position, const ImColor& color);
+    PlayerBase(size_t gid, Eigen::Vector2f position, const Color& color);
 
     /// @brief Destructor
     virtual ~PlayerBase() = default;
@@ -51,7 +53,7 @@ class PlayerBase
     [[nodiscard]] const std::string& GetName() const;
 
     /// @brief Return the player color
-    [[nodiscard]] ImColor GetColor() const;
+    [[nodiscard]] Color GetColor() const;
 
     /// @brief Get the currently available resources of the player
     [[nodiscard]] const std::array<size_t, ResourceType_COUNT>& GetResources() const;
@@ -66,8 +68,20 @@ class PlayerBase
     //                                                 Functions
     // ###########################################################################################################
 
+    /// @brief Creates a unit and spawns it at the headquarters. Only works if enough resources available
+    /// @tparam T Type of the unit, e.g. the robot of the team
+    /// @param[in] args Arguments of the constructor of the unit, e.g. SpawnUnit<Robot>(this, Eigen::Vector2f{}, 0.0F)
+    /// @return Pointer to the spawned unit or nullptr if not enough resources were available
+    template<typename T, typename... Args>
+    T* SpawnUnit(Args&&... args)
+    {
+        auto unit = Pool().Create<T>(std::forward<Args>(args)...);
+        T* spawned = unit.get();
+        return TrySpawn(std::move(unit)) ? spawned : nullptr;
+    }
+
     /// @brief Spawns the unit at the headquarters. Only works if enough resources available
-    /// @param[in] unit Shared_ptr to the unit to spawn
+    /// @param[in] unit Shared_ptr to the unit to spawn (SpawnUnit<T>(...) creates the unit in the unit pool instead)
     void SpawnUnit(const std::shared_ptr<Unit>& unit);
 
     // ###########################################################################################################
@@ -93,10 +107,10 @@ class PlayerBase
     const Eigen::Vector2f m_hqPosition{ 0.0, 0.0 };
 
     /// Color of the player's units
-    ImColor m_color{ 255, 255, 255 };
+    Color m_color{ 255, 255, 255 };
 
     /// List of all units the player posesses
-    std::vector<std::shared_ptr<Unit>> m_units;
+    std::vector<UnitPtr> m_units;
 
     /// Whether the player died
     bool m_isAlive = true;
@@ -107,11 +121,29 @@ class PlayerBase
     /// Total collected resources
     std::array<size_t, ResourceType_COUNT> m_collectedResourcesTotal{};
 
+    /// Amount of units (including the headquarter) which got destroyed
+    size_t m_unitsLost = 0;
+
     /// @brief Adds a unit to the list of game units the player possesses
     /// @param[in] unit The unit to add
-    void AddUnit(const std::shared_ptr<Unit>& unit);
+    void AddUnit(UnitPtr unit);
+
+    /// @brief Pays the unit and places it at the headquarters, if enough resources are available
+    /// @param[in] unit The unit to spawn (destroyed if it can not be paid)
+    /// @return True if the unit was spawned
+    bool TrySpawn(UnitPtr unit);
+
+    /// @brief Unit pool of the current world
+    static UnitPool& Pool();
 
     friend class GameState;
+    friend struct RenderState;
+    friend class World;
+    friend class HeadlessApplication;
+    friend class Tournament;
+    friend class Replay;
+    friend class Snapshot;
+    friend class Benchmarks;
     friend class Unit;
     friend class RobotBase;
     friend class HeadquartersBase;
@@ -6,24 +6,32 @@
 #pragma once
 
 #include <Eigen/Core>
-#include <imgui.h>
+
+#include "internal/helper/Color.hpp"
 
 namespace oop::internal
 {
 
+/// @brief Satellite flying over the board in a straight line with constant speed.
+///
+/// The satellite only stores where and when it was spawned, its position is evaluated in closed form on demand.
 class Satellite
 {
   public:
     /// @brief Constructor
-    Satellite(const Eigen::Vector2f& position, float heading);
+    /// @param[in] position Position where the satellite spawns
+    /// @param[in] heading Direction of the satellite measured from North in mathematical positive direction [rad]
+    /// @param[in] spawnTime Game time of the spawn [s]
+    Satellite(const Eigen::Vector2f& position, float heading, float spawnTime);
 
   private:
-    /// @brief Draw the satellite
-    void Draw() const;
+    /// @brief Position of the satellite
+    /// @param[in] time Game time to evaluate the position at [s]
+    [[nodiscard]] Eigen::Vector2f Position(float time) const { return m_spawnPos + (m_speed * (time - m_spawnTime)) * m_direction; }
 
-    /// @brief Updates the satellite state
-    /// @param[in] deltaTime Time passed since last update
-    void Update(float deltaTime);
+    /// @brief Wrong position of a faulty satellite, which its distance measurements refer to
+    /// @param[in] time Game time to evaluate the position at [s]
+    [[nodiscard]] Eigen::Vector2f FaultyPosition(float time) const { return m_spawnPos + (m_faultySpeed * (time - m_spawnTime)) * m_direction; }
 
     /// Global Id
     size_t m_gid;
@@ -32,10 +40,13 @@ class Satellite
     static constexpr float m_size = 2.0F;
 
     /// The satellite color
-    static const inline ImColor m_color{ 240, 230, 220 };
+    static constexpr Color m_color{ 240, 230, 220 };
+
+    /// Position where the satellite spawned
+    Eigen::Vector2f m_spawnPos{ 0.0, 0.0 };
 
-    /// Position of the satellite
-    Eigen::Vector2f m_pos{ 0.0, 0.0 };
+    /// Game time when the satellite spawned [s]
+    float m_spawnTime = 0.0F;
 
     /// Speed with what the satellite is moving
     float m_speed = 8.0F;
@@ -43,16 +54,20 @@ class Satellite
     /// @brief Direction of the satellite measured from North in mathematical positive direction [rad]
     float m_heading = 0.0;
 
+    /// Unit vector in the direction of the heading
+    Eigen::Vector2f m_direction{ 0.0, 1.0 };
+
     /// @brief When faulty it will transmit wrong info about its position
     bool m_isFaulty = false;
 
-    /// Faulty position of the satellite
-    Eigen::Vector2f m_faultyPos{ 0.0, 0.0 };
-
     /// Faulty Speed with what the satellite is moving
     float m_faultySpeed = 8.0F;
 
     friend class GameState;
+    friend struct RenderState;
+    friend class World;
+    friend class Replay;
+    friend class Snapshot;
     friend class Unit;
 };
 
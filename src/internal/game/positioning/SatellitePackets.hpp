@@ -0,0 +1,205 @@
+/// @file SatellitePackets.hpp
+/// @brief Contiguous storage and views for satellite distance measurement packets
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace oop
+{
+
+/// @brief Non-owning view on the bytes of a single satellite distance measurement packet
+class SatellitePacket
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] data Pointer to the first byte of the packet
+    /// @param[in] size Amount of bytes in the packet
+    constexpr SatellitePacket(const unsigned char* data, size_t size)
+        : m_data(data), m_size(size) {}
+
+    /// @brief Pointer to the first byte of the packet
+    [[nodiscard]] constexpr const unsigned char* data() const { return m_data; }
+    /// @brief Amount of bytes in the packet
+    [[nodiscard]] constexpr size_t size() const { return m_size; }
+    /// @brief Checks whether the packet has no bytes
+    [[nodiscard]] constexpr bool empty() const { return m_size == 0; }
+
+    /// @brief Iterator to the first byte
+    [[nodiscard]] constexpr const unsigned char* begin() const { return m_data; }
+    /// @brief Iterator past the last byte
+    [[nodiscard]] constexpr const unsigned char* end() const { return m_data + m_size; }
+
+    /// @brief Access to a byte without bounds checking
+    /// @param[in] index Index of the byte
+    constexpr const unsigned char& operator[](size_t index) const { return m_data[index]; }
+
+    /// @brief Access to a byte with bounds checking
+    /// @param[in] index Index of the byte
+    [[nodiscard]] const unsigned char& at(size_t index) const
+    {
+        if (index >= m_size)
+        {
+            throw std::out_of_range("SatellitePacket::at");
+        }
+        return m_data[index];
+    }
+
+  private:
+    /// Pointer to the first byte of the packet
+    const unsigned char* m_data;
+    /// Amount of bytes in the packet
+    size_t m_size;
+};
+
+namespace internal
+{
+class SatellitePacketArena;
+} // namespace internal
+
+/// @brief Non-owning view on all satellite distance measurement packets a unit received in the current tick.
+///
+/// The view is valid until the unit receives new measurements in the next tick.
+class SatellitePacketList
+{
+  public:
+    /// @brief Iterator creating a packet view per record
+    class Iterator
+    {
+      public:
+        /// @brief Constructor
+        /// @param[in] arena Arena the packets are stored in
+        /// @param[in] index Index of the packet
+        Iterator(const internal::SatellitePacketArena* arena, size_t index)
+            : m_arena(arena), m_index(index) {}
+
+        /// @brief Returns the view of the current packet
+        SatellitePacket operator*() const;
+        /// @brief Advances to the next packet
+        Iterator& operator++()
+        {
+            ++m_index;
+            return *this;
+        }
+        /// @brief Compares two iterators
+        bool operator==(const Iterator& rhs) const { return m_index == rhs.m_index; }
+        /// @brief Compares two iterators
+        bool operator!=(const Iterator& rhs) const { return m_index != rhs.m_index; }
+
+      private:
+        /// Arena the packets are stored in
+        const internal::SatellitePacketArena* m_arena;
+        /// Index of the packet
+        size_t m_index;
+    };
+
+    /// @brief Constructor
+    /// @param[in] arena Arena the packets are stored in
+    explicit SatellitePacketList(const internal::SatellitePacketArena& arena)
+        : m_arena(&arena) {}
+
+    /// @brief Amount of packets
+    [[nodiscard]] size_t size() const;
+    /// @brief Checks whether no packets were received
+    [[nodiscard]] bool empty() const { return size() == 0; }
+    /// @brief Returns the view of the packet
+    /// @param[in] index Index of the packet
+    SatellitePacket operator[](size_t index) const;
+
+    /// @brief Iterator to the first packet
+    [[nodiscard]] Iterator begin() const { return { m_arena, 0 }; }
+    /// @brief Iterator past the last packet
+    [[nodiscard]] Iterator end() const { return { m_arena, size() }; }
+
+  private:
+    /// Arena the packets are stored in
+    const internal::SatellitePacketArena* m_arena;
+};
+
+namespace internal
+{
+
+/// @brief Stores all packets of a tick back to back in a single byte buffer with an offset/length record per packet.
+///
+/// Clearing keeps the capacity, so after the first ticks no more heap allocations happen.
+class SatellitePacketArena
+{
+  public:
+    /// @brief Reserves memory, so that appending packets does not allocate
+    /// @param[in] packetCapacity Amount of packets to reserve memory for
+    /// @param[in] byteCapacity Amount of bytes to reserve memory for
+    void Reserve(size_t packetCapacity, size_t byteCapacity)
+    {
+        m_records.reserve(packetCapacity);
+        m_bytes.reserve(byteCapacity);
+    }
+
+    /// @brief Removes all packets but keeps the memory
+    void Clear()
+    {
+        m_records.clear();
+        m_bytes.clear();
+    }
+
+    /// @brief Appends a zero initialized packet and returns a pointer to its bytes
+    /// @param[in] size Amount of bytes of the packet
+    /// @return Pointer to the packet which stays valid till the next call to Append or Clear
+    unsigned char* Append(size_t size)
+    {
+        const size_t offset = m_bytes.size();
+        m_records.push_back({ static_cast<uint32_t>(offset), static_cast<uint32_t>(size) });
+        m_bytes.resize(offset + size);
+        return m_bytes.data() + offset;
+    }
+
+    /// @brief Amount of packets
+    [[nodiscard]] size_t Size() const
+    {
+        return m_records.size();
+    }
+
+    /// @brief Returns the view of the packet
+    /// @param[in] index Index of the packet
+    [[nodiscard]] SatellitePacket Packet(size_t index) const
+    {
+        const auto& record = m_records[index];
+        return { m_bytes.data() + record.offset, record.size };
+    }
+
+  private:
+    /// @brief Location of a packet in the byte buffer
+    struct Record
+    {
+        uint32_t offset; ///< Offset of the first byte
+        uint32_t size;   ///< Amount of bytes
+    };
+
+    /// Location of all packets
+    std::vector<Record> m_records;
+    /// Bytes of all packets
+    std::vector<unsigned char> m_bytes;
+};
+
+} // namespace internal
+
+inline SatellitePacket SatellitePacketList::Iterator::operator*() const
+{
+    return m_arena->Packet(m_index);
+}
+
+inline size_t SatellitePacketList::size() const
+{
+    return m_arena->Size();
+}
+
+inline SatellitePacket SatellitePacketList::operator[](size_t index) const
+{
+    return m_arena->Packet(index);
+}
+
+} // namespace oop
@@ -5,11 +5,13 @@
 
 #pragma once
 
+#include <string>
 #include <string_view>
 #include <Eigen/Core>
-#include <imgui.h>
 #include <fmt/format.h>
 
+#include "internal/helper/Color.hpp"
+
 namespace oop
 {
 
@@ -42,18 +44,15 @@ class Resource
     /// @brief Get the string type of the resource
     [[nodiscard]] std::string GetTypeName() const;
 
-    /// @brief Draw the resource
-    void Draw() const;
-
     /// The size of the resource
     [[nodiscard]] float GetDrawSize() const;
 
     /// @brief Return the resource color
-    [[nodiscard]] ImColor color() const;
+    [[nodiscard]] Color color() const;
 
     /// @brief Return the resource color for the type
     /// @param[in] type Resource type
-    static ImColor color(ResourceType type);
+    static Color color(ResourceType type);
 
     /// Global Id
     size_t m_gid;
@@ -71,6 +70,11 @@ class Resource
     float m_heading = 0.0;
 
     friend class GameState;
+    friend struct RenderState;
+    friend class World;
+    friend class Benchmarks;
+    friend class Replay;
+    friend class Snapshot;
     friend class Unit;
     friend class RobotBase;
 };
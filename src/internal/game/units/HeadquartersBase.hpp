@@ -32,18 +32,12 @@ class HeadquartersBase : public Unit
     //                                      Private content (inaccessible)
     // ###########################################################################################################
   private:
-    /// @brief Checks whether the unit is the HQ
-    [[nodiscard]] bool IsHeadquarters() const final;
-
-    /// @brief Draw the unit
-    void Draw() const final;
-
     /// The size of a headquarters
     [[nodiscard]] float GetDrawSize() const final;
 
-    /// @brief Updates the unit state
+    /// @brief Applies the planned action to the world
     /// @param[in] deltaTime Time passed since last update
-    void Update(float deltaTime) final;
+    void ApplyAction(float deltaTime) final;
 };
 
 } // namespace oop::internal
@@ -0,0 +1,93 @@
+#include "MoveIntegrator.hpp"
+
+#include <algorithm>
+
+#include "internal/game/Settings.hpp"
+#include "internal/game/units/Unit.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #define OOP_MOVE_INTEGRATOR_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace oop::internal
+{
+
+void MoveIntegrator::Clear()
+{
+    m_units.clear();
+    m_posX.clear();
+    m_posY.clear();
+    m_speed.clear();
+    m_carrying.clear();
+    m_directionX.clear();
+    m_directionY.clear();
+}
+
+void MoveIntegrator::Add(Unit& unit)
+{
+    m_units.push_back(&unit);
+    m_posX.push_back(unit.m_pos.x());
+    m_posY.push_back(unit.m_pos.y());
+    m_speed.push_back(unit.m_speed);
+    m_carrying.push_back(unit.m_resourcesCarried.second ? 1 : 0);
+    m_directionX.push_back(unit.m_direction.x());
+    m_directionY.push_back(unit.m_direction.y());
+}
+
+void MoveIntegrator::Advance(float deltaTime)
+{
+    const size_t count = m_units.size();
+    float* posX = m_posX.data();
+    float* posY = m_posY.data();
+    const float* speeds = m_speed.data();
+    const uint32_t* carrying = m_carrying.data();
+    const double* directionX = m_directionX.data();
+    const double* directionY = m_directionY.data();
+    const double minX = glob::game::BOARD_WIDTH.at(0);
+    const double maxX = glob::game::BOARD_WIDTH.at(1);
+    const double minY = glob::game::BOARD_HEIGHT.at(0);
+    const double maxY = glob::game::BOARD_HEIGHT.at(1);
+
+    size_t i = 0;
+#ifdef OOP_MOVE_INTEGRATOR_SSE2
+    // 4 units per iteration. The steps are computed in single and the positions in double precision like Unit::ApplyMove()
+    const __m128 speedDecrease = _mm_set1_ps(glob::units::SPEED_DECREASE_WHILE_CARRYING);
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128d lowerX = _mm_set1_pd(minX);
+    const __m128d upperX = _mm_set1_pd(maxX);
+    const __m128d lowerY = _mm_set1_pd(minY);
+    const __m128d upperY = _mm_set1_pd(maxY);
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 carryMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(carrying + i)), _mm_setzero_si128()));
+        const __m128 step = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(speeds + i), _mm_andnot_ps(carryMask, speedDecrease)), dt);
+        const __m128d stepLow = _mm_cvtps_pd(step);
+        const __m128d stepHigh = _mm_cvtps_pd(_mm_movehl_ps(step, step));
+
+        auto advance = [&](float* pos, const double* direction, __m128d lower, __m128d upper) {
+            const __m128 position = _mm_loadu_ps(pos + i);
+            __m128d low = _mm_add_pd(_mm_cvtps_pd(position), _mm_mul_pd(stepLow, _mm_loadu_pd(direction + i)));
+            __m128d high = _mm_add_pd(_mm_cvtps_pd(_mm_movehl_ps(position, position)), _mm_mul_pd(stepHigh, _mm_loadu_pd(direction + i + 2)));
+            low = _mm_min_pd(_mm_max_pd(low, lower), upper);
+            high = _mm_min_pd(_mm_max_pd(high, lower), upper);
+            _mm_storeu_ps(pos + i, _mm_movelh_ps(_mm_cvtpd_ps(low), _mm_cvtpd_ps(high)));
+        };
+        advance(posX, directionX, lowerX, upperX);
+        advance(posY, directionY, lowerY, upperY);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        const float speed = speeds[i] - (carrying[i] ? glob::units::SPEED_DECREASE_WHILE_CARRYING : 0.0F);
+        posX[i] = static_cast<float>(std::clamp(posX[i] + speed * deltaTime * directionX[i], minX, maxX));
+        posY[i] = static_cast<float>(std::clamp(posY[i] + speed * deltaTime * directionY[i], minY, maxY));
+    }
+
+    for (size_t u = 0; u < count; u++)
+    {
+        m_units[u]->m_pos = { posX[u], posY[u] };
+    }
+}
+
+} // namespace oop::internal
@@ -0,0 +1,54 @@
+/// @file MoveIntegrator.hpp
+/// @brief Moves many units at once along their cached heading directions
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace oop::internal
+{
+
+class Unit;
+
+/// @brief Advances all units which move in an update in one pass over contiguous arrays.
+///
+/// The positions, speeds and directions of the added units are copied into separate arrays, which Advance() processes
+/// with SSE2 four units at a time. The speed decrease while carrying is a mask and the clamping to the board are
+/// minimum and maximum operations instead of branches. The operations are the same as in Unit::ApplyMove(), so the
+/// positions are bit identical to moving the units one after another.
+class MoveIntegrator
+{
+  public:
+    /// @brief Removes all units (the arrays keep their capacity)
+    void Clear();
+
+    /// @brief Adds a unit which moves in this update
+    /// @param[in] unit Unit to move
+    void Add(Unit& unit);
+
+    /// @brief Moves all added units by one time step and writes their positions back
+    /// @param[in] deltaTime Time passed since last update
+    void Advance(float deltaTime);
+
+  private:
+    /// Units to move
+    std::vector<Unit*> m_units;
+    /// X coordinates of the positions
+    std::vector<float> m_posX;
+    /// Y coordinates of the positions
+    std::vector<float> m_posY;
+    /// Speeds without the decrease while carrying
+    std::vector<float> m_speed;
+    /// Flags whether the units carry resources (0 or 1)
+    std::vector<uint32_t> m_carrying;
+    /// X components of the heading directions
+    std::vector<double> m_directionX;
+    /// Y components of the heading directions
+    std::vector<double> m_directionY;
+};
+
+} // namespace oop::internal
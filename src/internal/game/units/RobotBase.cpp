@@ -1,10 +1,7 @@
 #include "RobotBase.hpp"
 
-#include <fmt/core.h>
-#include <implot.h>
-#include "internal/gui/helper/ImPlotHelper.hpp"
 #include "internal/game/player/PlayerBase.hpp"
-#include "internal/game/GameState.hpp"
+#include "internal/game/World.hpp"
 #include "internal/game/Settings.hpp"
 #include "internal/helper/RandomNumberGenerator.hpp"
 
@@ -12,7 +9,10 @@ namespace oop::internal
 {
 
 RobotBase::RobotBase(PlayerBase* parent, const Eigen::Vector2f& position, float heading)
-    : Unit(parent, GameState::GetNextGID(), position, heading) {}
+    : Unit(parent, World::Current().GetNextGID(), position, heading)
+{
+    m_kind = Kind_Robot;
+}
 
 // ###########################################################################################################
 //                                                  Actions
@@ -49,6 +49,10 @@ void RobotBase::DoDiscardResources()
 
 const std::vector<ResourceScanResult>& RobotBase::ScanForResources() const
 {
+    if (m_resourceScanOutdated)
+    {
+        UpdateResourceScan();
+    }
     return m_currentResourceScan;
 }
 
@@ -61,100 +65,28 @@ const std::pair<ResourceType, size_t>& RobotBase::GetCarriedResources() const
 //                                      Private content (inaccessible)
 // ###########################################################################################################
 
-bool RobotBase::IsHeadquarters() const
-{
-    return false;
-}
-
-void RobotBase::Draw() const
-{
-    using internal::gui::helper::Rotate;
-    using internal::gui::helper::PlotToPixel;
-
-    Unit::Draw();
-
-    auto drawBackgroundShape = [this](const ImColor& color) {
-        Eigen::Vector2f M2 = m_pos + Rotate({ 0, 2.0 / 3.0 * GetDrawSize() + glob::gui::HOVER_OBJECT_SIZE_MODIFIER }, m_heading);
-        Eigen::Vector2f L2 = m_pos
-                             + Rotate({ -GetDrawSize() * std::tan(M_PI / 180.0 * 20) - glob::gui::HOVER_OBJECT_SIZE_MODIFIER,
-                                        -1.0 / 3.0 * GetDrawSize() - glob::gui::HOVER_OBJECT_SIZE_MODIFIER },
-                                      m_heading);
-        Eigen::Vector2f N2 = m_pos
-                             + Rotate({ GetDrawSize() * std::tan(M_PI / 180.0 * 20) + glob::gui::HOVER_OBJECT_SIZE_MODIFIER,
-                                        -1.0 / 3.0 * GetDrawSize() - 0.05 },
-                                      m_heading);
-        ImPlot::GetPlotDrawList()->AddTriangleFilled(ImPlot::PlotToPixels(M2.x(), M2.y()),
-                                                     ImPlot::PlotToPixels(N2.x(), N2.y()),
-                                                     ImPlot::PlotToPixels(L2.x(), L2.y()),
-                                                     color);
-    };
-
-    if (std::holds_alternative<std::shared_ptr<const Unit>>(GameState::selectedObject)
-        && std::get<std::shared_ptr<const Unit>>(GameState::selectedObject)
-        && std::get<std::shared_ptr<const Unit>>(GameState::selectedObject)->m_gid == m_gid)
-    {
-        drawBackgroundShape(glob::gui::COLOR_SELECTED);
-    }
-    else if (ImPlot::IsPlotHovered()
-             && (m_pos - Eigen::Vector2f{ ImPlot::GetPlotMousePos().x, ImPlot::GetPlotMousePos().y })
-                        .norm()
-                    <= GetDrawSize() * glob::gui::HOVER_OBJECT_SIZE_MODIFIER)
-    {
-        drawBackgroundShape(glob::gui::COLOR_HOVERED);
-    }
-
-    Eigen::Vector2f M = m_pos + Rotate({ 0, 2.0 / 3.0 * GetDrawSize() }, m_heading);
-    Eigen::Vector2f L = m_pos + Rotate({ -GetDrawSize() * std::tan(M_PI / 180.0 * 20), -1.0 / 3.0 * GetDrawSize() }, m_heading);
-    Eigen::Vector2f N = m_pos + Rotate({ GetDrawSize() * std::tan(M_PI / 180.0 * 20), -1.0 / 3.0 * GetDrawSize() }, m_heading);
-    ImPlot::GetPlotDrawList()->AddTriangleFilled(ImPlot::PlotToPixels(M.x(), M.y()),
-                                                 ImPlot::PlotToPixels(N.x(), N.y()),
-                                                 ImPlot::PlotToPixels(L.x(), L.y()),
-                                                 m_parent->GetColor());
-
-    if (glob::debug::DRAW_UNIT_COLLECT_RANGE)
-    {
-        auto color = m_parent->GetColor();
-        color.Value.w = 0.2F;
-        ImPlot::GetPlotDrawList()->AddCircle(ImPlot::PlotToPixels(m_pos.x(), m_pos.y()), static_cast<float>(PlotToPixel(m_collectRange)), color);
-    }
-
-    DrawOverlay();
-}
-
 float RobotBase::GetDrawSize() const
 {
     return 1.5F;
 }
 
-void RobotBase::Update(float deltaTime)
+void RobotBase::ApplyAction(float deltaTime)
 {
-    Unit::Update(deltaTime);
+    Unit::ApplyAction(deltaTime);
 
     if (m_action == Action_Move)
     {
-        float speed = m_speed - (m_resourcesCarried.second ? glob::units::SPEED_DECREASE_WHILE_CARRYING : 0.0F);
-
-        m_pos.x() = static_cast<float>(std::clamp(m_pos.x() + speed * deltaTime * std::cos(M_PI_2 + m_heading),
-                                                  glob::game::BOARD_WIDTH.at(0),
-                                                  glob::game::BOARD_WIDTH.at(1)));
-
-        m_pos.y() = static_cast<float>(std::clamp(m_pos.y() + speed * deltaTime * std::sin(M_PI_2 + m_heading),
-                                                  glob::game::BOARD_HEIGHT.at(0),
-                                                  glob::game::BOARD_HEIGHT.at(1)));
+        ApplyMove(deltaTime);
     }
     else if (m_action == Action_CollectResource)
     {
-        for (auto& resource : GameState::resources)
+        if (auto* resource = World::Current().FindResource(m_actionTargetGid);
+            resource && (m_pos - resource->m_pos).norm() <= m_collectRange)
         {
-            if (m_actionTargetGid == resource.m_gid && (m_pos - resource.m_pos).norm() <= m_collectRange)
-            {
-                int resourcesCollected = std::min(m_resourceContainerSize, resource.m_amount);
-                resource.m_amount -= resourcesCollected;
-
-                m_resourcesCarried = std::make_pair(resource.m_type, resourcesCollected);
+            int resourcesCollected = std::min(m_resourceContainerSize, resource->m_amount);
+            resource->m_amount -= resourcesCollected;
 
-                break;
-            }
+            m_resourcesCarried = std::make_pair(resource->m_type, resourcesCollected);
         }
     }
     else if (m_action == Action_DropOffResourcesAtHQ)
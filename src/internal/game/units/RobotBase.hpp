@@ -51,6 +51,9 @@ class RobotBase : public Unit
     // ###########################################################################################################
 
     /// @brief Scans the robot surroundings for resources
+    ///
+    /// The scan is computed by the first call and then kept till the unit is updated. Called in the Think of the player
+    /// it shows the state at the start of the update, called in the Think of the unit the state when the unit is updated.
     /// @return A list of scan results
     [[nodiscard]] const std::vector<ResourceScanResult>& ScanForResources() const;
 
@@ -61,18 +64,12 @@ class RobotBase : public Unit
     //                                      Private content (inaccessible)
     // ###########################################################################################################
   private:
-    /// @brief Checks whether the unit is the HQ
-    [[nodiscard]] bool IsHeadquarters() const final;
-
-    /// @brief Draw the unit
-    void Draw() const final;
-
     /// The size of a robot
     [[nodiscard]] float GetDrawSize() const final;
 
-    /// @brief Updates the unit state
+    /// @brief Applies the planned action to the world
     /// @param[in] deltaTime Time passed since last update
-    void Update(float deltaTime) final;
+    void ApplyAction(float deltaTime) final;
 };
 
 } // namespace oop::internal
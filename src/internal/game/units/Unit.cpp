@@ -1,13 +1,15 @@
 #include "Unit.hpp"
 
-#include <fmt/format.h>
-#include <implot.h>
-#include "internal/gui/helper/ImPlotHelper.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
-#include "internal/GameApplication.hpp"
-#include "internal/game/GameState.hpp"
+#include "internal/game/World.hpp"
 #include "internal/game/Settings.hpp"
 #include "internal/helper/RandomNumberGenerator.hpp"
+#include "internal/helper/ScanKernel.hpp"
+#include "internal/helper/TickArena.hpp"
+#include "helper/Crc16.hpp"
 
 namespace oop::internal
 {
@@ -15,23 +17,12 @@ namespace oop::internal
 namespace hidden
 {
 
-/// CRC16-CCITT (XModem) algorithm
-uint16_t computeCrc16(const unsigned char* data, size_t length)
-{
-    uint16_t crc = 0;
-
-    for (uint32_t i = 0; i < length; i++)
-    {
-        crc = static_cast<uint16_t>((crc >> 8) | (crc << 8));
-
-        crc = static_cast<uint16_t>(crc ^ static_cast<uint8_t>(data[i]));
-        crc ^= static_cast<uint16_t>(static_cast<uint8_t>(crc & 0xFF) >> 4);
-        crc ^= static_cast<uint16_t>((crc << 8) << 4);
-        crc ^= static_cast<uint16_t>(((crc & 0xFF) << 4) << 1);
-    }
-
-    return crc;
-}
+/// Size of a satellite distance measurement without random bytes
+constexpr size_t SATELLITE_MSG_SIZE = 3 * sizeof(char) + 3 * sizeof(float) + sizeof(uint16_t);
+/// Maximum amount of random bytes the satellites add to each side of a measurement
+constexpr size_t SATELLITE_MAX_RNG_BYTES = 10;
+/// Amount of results the scans of a unit have space for from its spawn on, so that the first contacts do not allocate
+constexpr size_t INITIAL_SCAN_CAPACITY = 16;
 
 } // namespace hidden
 
@@ -39,22 +30,29 @@ Unit::Unit(PlayerBase* parent, size_t gid, Eigen::Vector2f position, float headi
     : m_gid(gid),
       m_parent(parent),
       m_pos(std::move(position)),
-      m_heading(heading),
-      m_headingBias(RandomNumberGenerator::userRngGenerator().uniform_real_distribution<float>(-glob::game::ERROR_HEADING_PRECISION / 2.0F,
-                                                                                               glob::game::ERROR_HEADING_PRECISION / 2.0F)),
-      m_speed(glob::units::ATTR_BASE_SPEED + RandomNumberGenerator::userRngGenerator().normal_distribution<float>(-0.1F, 0.1F)),
-      m_maxHealth(glob::units::ATTR_BASE_HEALTH + RandomNumberGenerator::userRngGenerator().normal_distribution<float>(-1.0F, 1.0F)),
-      m_scanRange(glob::units::ATTR_BASE_SCAN_RANGE + RandomNumberGenerator::userRngGenerator().normal_distribution<float>(-0.1F, 0.1F)),
-      m_collectRange(glob::units::ATTR_BASE_COLLECT_RANGE + RandomNumberGenerator::userRngGenerator().normal_distribution<float>(-0.1F, 0.1F)),
       m_resourceContainerSize(glob::units::ATTR_BASE_CONTAINER_SIZE),
-      m_attackPower(glob::units::ATTR_BASE_ATTACK_POWER),
-      m_attackRange(glob::units::ATTR_BASE_ATTACK_RANGE + RandomNumberGenerator::userRngGenerator().normal_distribution<float>(-0.1F, 0.1F))
+      m_attackPower(glob::units::ATTR_BASE_ATTACK_POWER)
 {
+    auto& rng = RandomNumberGenerator::userRngGenerator(m_gid, RandomPurpose_Attributes);
+
+    AssignHeading(heading);
+    m_headingBias = rng.uniform_real_distribution<float>(-glob::game::ERROR_HEADING_PRECISION / 2.0F, glob::game::ERROR_HEADING_PRECISION / 2.0F);
+    m_speed = glob::units::ATTR_BASE_SPEED + rng.normal_distribution<float>(-0.1F, 0.1F);
+    m_maxHealth = glob::units::ATTR_BASE_HEALTH + rng.normal_distribution<float>(-1.0F, 1.0F);
+    m_scanRange = glob::units::ATTR_BASE_SCAN_RANGE + rng.normal_distribution<float>(-0.1F, 0.1F);
+    m_collectRange = glob::units::ATTR_BASE_COLLECT_RANGE + rng.normal_distribution<float>(-0.1F, 0.1F);
+    m_attackRange = glob::units::ATTR_BASE_ATTACK_RANGE + rng.normal_distribution<float>(-0.1F, 0.1F);
+
     m_currentHealth = m_maxHealth;
 
+    m_currentUnitScan.reserve(hidden::INITIAL_SCAN_CAPACITY);
+    m_currentResourceScan.reserve(hidden::INITIAL_SCAN_CAPACITY);
+    m_satellitePackets.Reserve(glob::positioning::NUM_SAT,
+                               glob::positioning::NUM_SAT * (hidden::SATELLITE_MSG_SIZE + 2 * hidden::SATELLITE_MAX_RNG_BYTES));
+
     if (glob::game::ENABLE_DISTANCE_CLOCK_OFFSET)
     {
-        m_clockOffset = RandomNumberGenerator::userRngGenerator().normal_distribution<>(-glob::game::STDDEV_POSITIONING_CLOCK_OFFSET, glob::game::STDDEV_POSITIONING_CLOCK_OFFSET);
+        m_clockOffset = rng.normal_distribution<>(-glob::game::STDDEV_POSITIONING_CLOCK_OFFSET, glob::game::STDDEV_POSITIONING_CLOCK_OFFSET);
     }
 }
 
@@ -94,11 +92,38 @@ float Unit::GetHealth() const
 
 const std::vector<UnitScanResult>& Unit::ScanForUnits() const
 {
+    if (m_unitScanOutdated)
+    {
+        UpdateUnitScan();
+    }
     return m_currentUnitScan;
 }
 
+SatellitePacketList Unit::GetSatellitePackets() const
+{
+    if (m_satellitePacketsOutdated)
+    {
+        UpdateSatelliteMeasurements();
+    }
+    return SatellitePacketList(m_satellitePackets);
+}
+
 const std::vector<std::vector<unsigned char>>& Unit::GetSatelliteDistanceMeasurements() const
 {
+    if (m_satellitePacketsOutdated)
+    {
+        UpdateSatelliteMeasurements();
+    }
+    if (m_satelliteDistanceMeasurementOutdated)
+    {
+        m_currentSatelliteDistanceMeasurement.resize(m_satellitePackets.Size());
+        for (size_t i = 0; i < m_satellitePackets.Size(); i++)
+        {
+            const auto packet = m_satellitePackets.Packet(i);
+            m_currentSatelliteDistanceMeasurement.at(i).assign(packet.begin(), packet.end());
+        }
+        m_satelliteDistanceMeasurementOutdated = false;
+    }
     return m_currentSatelliteDistanceMeasurement;
 }
 
@@ -199,7 +224,13 @@ void Unit::SetHeading(float heading)
     {
         heading -= static_cast<float>(2 * M_PI);
     }
+    AssignHeading(heading);
+}
+
+void Unit::AssignHeading(float heading)
+{
     m_heading = heading;
+    m_direction = { std::cos(M_PI_2 + m_heading), std::sin(M_PI_2 + m_heading) };
 }
 
 // ###########################################################################################################
@@ -234,201 +265,236 @@ void Unit::ApplyUnitAttributeModifiers()
     m_currentHealth = m_maxHealth;
 }
 
-void Unit::Draw() const
+bool Unit::IsHeadquarters() const
 {
-    using internal::gui::helper::PlotToPixel;
+    return m_kind == Kind_Headquarters;
+}
+
+void Unit::DrawOverlay() const {}
 
-    if (glob::debug::DRAW_UNIT_HEALTH_BAR)
+void Unit::UpdateUnitScan() const
+{
+    const auto& world = World::Current();
+    m_unitScanOutdated = false;
+
+    // Candidates are the units of the neighbour list and the units spawned after the lists were built. Without a valid
+    // list (spawned this update or scanning outside of an update after units were removed) all units are candidates
+    const bool useList = !world.m_neighbourListsOutdated && m_neighbourListIndex != NO_NEIGHBOUR_LIST;
+    size_t listBegin = 0;
+    size_t listEnd = 0;
+    size_t count = 0;
+    if (useList)
     {
-        ImPlot::GetPlotDrawList()->AddRectFilled(ImPlot::PlotToPixels(m_pos.x() - GetDrawSize() * 3.0 / 7.0,
-                                                                      m_pos.y() + GetDrawSize() * 3.0 / 4.0 + 0.1),
-                                                 ImPlot::PlotToPixels(m_pos.x() + GetDrawSize() * 3.0 / 7.0,
-                                                                      m_pos.y() + GetDrawSize() * 3.0 / 4.0 - 0.1),
-                                                 ImColor{ 100, 100, 100 });
-        ImPlot::GetPlotDrawList()->AddRectFilled(ImPlot::PlotToPixels(m_pos.x() - GetDrawSize() * 3.0 / 7.0 + 0.03,
-                                                                      m_pos.y() + GetDrawSize() * 3.0 / 4.0 + 0.07),
-                                                 ImPlot::PlotToPixels(m_pos.x() + (GetDrawSize() * 3.0 / 7.0 - 0.03) * (2 * m_currentHealth / m_maxHealth - 1),
-                                                                      m_pos.y() + GetDrawSize() * 3.0 / 4.0 - 0.07),
-                                                 ImColor{ 1.0F - m_currentHealth / m_maxHealth, m_currentHealth / m_maxHealth, 0.0F });
+        listBegin = world.m_neighbourOffsets.at(m_neighbourListIndex);
+        listEnd = world.m_neighbourOffsets.at(m_neighbourListIndex + 1);
+        count = listEnd - listBegin;
     }
-    if (glob::debug::DRAW_GID)
+    for (size_t p = 0; p < world.m_players.size(); p++)
     {
-        auto color = m_parent->GetColor().Value;
-        color.w = 0.7F;
-        ImPlot::PushStyleColor(ImPlotCol_InlayText, color);
-        ImPlot::PlotText(fmt::format("{}", m_gid).c_str(), m_pos.x() - GetDrawSize() * 3.0 / 5.0, m_pos.y() - GetDrawSize() * 3.0 / 5.0);
-        ImPlot::PopStyleColor();
+        count += world.m_players.at(p)->m_units.size() - (useList ? world.m_neighbourListUnitCount.at(p) : 0);
     }
-
-    if (glob::debug::DRAW_UNIT_SCAN_RANGE)
+    m_unitScanCandidates = count;
+
+    auto& arena = TickArena::ForThread();
+    TickArena::Scope arenaScope(arena);
+    auto* candidates = arena.Allocate<World::UnitGridEntry>(count);
+    auto* xs = arena.Allocate<float>(count);
+    auto* ys = arena.Allocate<float>(count);
+    auto* indices = arena.Allocate<uint32_t>(count);
+    auto* distances = arena.Allocate<float>(count);
+    auto* headings = arena.Allocate<float>(count);
+
+    size_t c = 0;
+    if (useList)
     {
-        auto color = m_parent->GetColor();
-        color.Value.w = 0.4F;
-        ImPlot::GetPlotDrawList()->AddCircle(ImPlot::PlotToPixels(m_pos.x(), m_pos.y()), static_cast<float>(PlotToPixel(m_scanRange)), color);
+        std::copy(world.m_neighbours.begin() + static_cast<std::ptrdiff_t>(listBegin), world.m_neighbours.begin() + static_cast<std::ptrdiff_t>(listEnd), candidates);
+        c = listEnd - listBegin;
     }
-    if (glob::debug::DRAW_UNIT_ATTACK_RANGE)
+    for (size_t p = 0; p < world.m_players.size(); p++)
     {
-        ImPlot::GetPlotDrawList()->AddCircle(ImPlot::PlotToPixels(m_pos.x(), m_pos.y()), static_cast<float>(PlotToPixel(m_attackRange)), ImColor{ 255, 0, 0, 120 });
-    }
-
-    if (glob::debug::DRAW_OBJECTS_IN_SCAN_RANGE)
-    {
-        for (const auto& scanResult : m_currentUnitScan)
-        {
-            Eigen::Vector2f target = m_pos + scanResult.distance * Eigen::Vector2f{ std::cos(scanResult.heading + M_PI_2), std::sin(scanResult.heading + M_PI_2) };
-            auto it = std::find_if(GameState::players.begin(),
-                                   GameState::players.end(),
-                                   [scanResult](const std::shared_ptr<PlayerBase>& player) { return player->m_gid == scanResult.playerId; });
-            ImColor col{ 153, 76, 0 };
-            if (it != GameState::players.end())
-            {
-                col = (*it)->GetColor();
-            }
-            col.Value.w = 0.3F;
-
-            ImPlot::GetPlotDrawList()->AddLine(ImPlot::PlotToPixels(m_pos.x(), m_pos.y()),
-                                               ImPlot::PlotToPixels(target.x(), target.y()), col);
-        }
-        for (const auto& scanResult : m_currentResourceScan)
+        const auto& units = world.m_players.at(p)->m_units;
+        for (size_t u = useList ? world.m_neighbourListUnitCount.at(p) : 0; u < units.size(); u++)
         {
-            Eigen::Vector2f target = m_pos + scanResult.distance * Eigen::Vector2f{ std::cos(scanResult.heading + M_PI_2), std::sin(scanResult.heading + M_PI_2) };
-            auto col = Resource::color(scanResult.type);
-            col.Value.w = 0.3F;
-            ImPlot::GetPlotDrawList()->AddLine(ImPlot::PlotToPixels(m_pos.x(), m_pos.y()),
-                                               ImPlot::PlotToPixels(target.x(), target.y()), col);
+            candidates[c++] = { (uint64_t{ p } << 32U) | u, units.at(u).get() };
         }
     }
 
-    if (glob::debug::DRAW_SATELLITE_COUNT_ON_UNITS && m_parent->m_gid)
+    // Scan results are ordered like iterating over all players and their units
+    if (useList && count != listEnd - listBegin)
     {
-        ImPlot::PushStyleColor(ImPlotCol_InlayText, m_parent->GetColor().Value);
-        ImPlot::PlotText(fmt::format("{}", m_satelliteCount).c_str(), m_pos.x() + GetDrawSize() * 3.0 / 4.0, m_pos.y() + GetDrawSize() * 3.0 / 4.0);
-        ImPlot::PopStyleColor();
+        std::sort(candidates, candidates + count, [](const auto& lhs, const auto& rhs) { return lhs.order < rhs.order; });
     }
 
-    if (glob::debug::DRAW_ENTITY_POSITIONS)
+    for (size_t i = 0; i < count; i++)
     {
-        ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(m_pos.x(), m_pos.y()), static_cast<float>(PlotToPixel(0.1)), ImColor{ 255, 0, 0 });
+        xs[i] = candidates[i].unit->m_pos.x();
+        ys[i] = candidates[i].unit->m_pos.y();
     }
+    const size_t found = ScanKernel::Scan(m_pos.x(), m_pos.y(), m_scanRange, xs, ys, count, indices, distances, headings);
 
-    if (constexpr float attackAnimationDuration = glob::units::ATTACK_BLOCK_TIME - 0.8F;
-        m_attackBlockTime > attackAnimationDuration)
+    m_currentUnitScan.clear();
+    if (m_currentUnitScan.capacity() < found)
+    {
+        m_currentUnitScan.reserve(2 * found); // Headroom, so that the results of moving units do not reallocate every tick
+    }
+    for (size_t i = 0; i < found; i++)
     {
-        ImPlot::GetPlotDrawList()->AddLine(ImPlot::PlotToPixels(m_pos.x(), m_pos.y()),
-                                           ImPlot::PlotToPixels(m_lastAttackedUnitPosition.x(), m_lastAttackedUnitPosition.y()),
-                                           ImColor{ 1.0F, 0.0F, 0.0F, (m_attackBlockTime - attackAnimationDuration) / (1.0F - attackAnimationDuration) });
-        if (GameApplication::controlledCamera)
+        const auto* unit = candidates[indices[i]].unit;
+        if (unit != this)
         {
-            ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(m_lastAttackedUnitPosition.x(), m_lastAttackedUnitPosition.y()),
-                                                       static_cast<float>(PlotToPixel(4.0)),
-                                                       ImColor{ 1.0F, 0.0F, 0.0F, 0.3F });
+            m_currentUnitScan.push_back({ unit->m_parent->m_gid, unit->m_gid, headings[i], distances[i], unit->m_currentHealth, unit->IsHeadquarters() });
         }
     }
 }
 
-void Unit::DrawOverlay() const {}
+void Unit::UpdateResourceScan() const
+{
+    const auto& world = World::Current();
+    m_resourceScanOutdated = false;
+
+    thread_local std::vector<size_t> candidates;
+    candidates.clear();
+    world.m_resourceGrid.ForEachInRadius(m_pos, m_scanRange + SpatialGrid<size_t>::TOLERANCE,
+                                         [](const Eigen::Vector2f& /* position */, size_t index) { candidates.push_back(index); });
+    m_resourceScanCandidates = candidates.size();
+    // Scan results are ordered by spawn time (the list of resources gets reordered when resources are removed)
+    std::sort(candidates.begin(), candidates.end(), [&world](size_t lhs, size_t rhs) {
+        return world.m_resources.at(lhs).m_gid < world.m_resources.at(rhs).m_gid;
+    });
+
+    auto& arena = TickArena::ForThread();
+    TickArena::Scope arenaScope(arena);
+    auto* xs = arena.Allocate<float>(candidates.size());
+    auto* ys = arena.Allocate<float>(candidates.size());
+    auto* indices = arena.Allocate<uint32_t>(candidates.size());
+    auto* distances = arena.Allocate<float>(candidates.size());
+    auto* headings = arena.Allocate<float>(candidates.size());
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        const auto& position = world.m_resources.at(candidates[i]).m_pos;
+        xs[i] = position.x();
+        ys[i] = position.y();
+    }
+    const size_t found = ScanKernel::Scan(m_pos.x(), m_pos.y(), m_scanRange, xs, ys, candidates.size(), indices, distances, headings);
 
-void Unit::UpdateAlways()
+    m_currentResourceScan.clear();
+    if (m_currentResourceScan.capacity() < found)
+    {
+        m_currentResourceScan.reserve(2 * found);
+    }
+    for (size_t i = 0; i < found; i++)
+    {
+        const auto& resource = world.m_resources.at(candidates[indices[i]]);
+        m_currentResourceScan.push_back({ resource.m_gid, headings[i], distances[i], resource.m_type, resource.m_amount });
+    }
+}
+
+void Unit::UpdateSatelliteMeasurements() const
 {
-    m_currentUnitScan.clear();
-    for (const auto& player : GameState::players)
+    auto& rng = RandomNumberGenerator::userRngGenerator(m_gid, RandomPurpose_SatelliteMeasurement);
+    const auto& world = World::Current();
+
+    m_satellitePackets.Clear();
+    m_satellitePacketsOutdated = false;
+    m_satelliteDistanceMeasurementOutdated = true;
+    for (const auto& satellite : world.m_satellites)
     {
-        for (const auto& unit : player->m_units)
+        const Eigen::Vector2f satellitePos = satellite.Position(world.m_satelliteTime);
+        if (float satUnitDistance = (m_pos - (satellite.m_isFaulty ? satellite.FaultyPosition(world.m_satelliteTime) : satellitePos)).norm();
+            satUnitDistance <= glob::positioning::VISIBILITY_RANGE)
         {
-            if (m_gid == unit->m_gid)
+            satUnitDistance += static_cast<float>(299'792'458.0 * m_clockOffset);
+
+            constexpr size_t msgSize = hidden::SATELLITE_MSG_SIZE;
+
+            size_t rngSizeStart = 0;
+            size_t rngSizeEnd = 0;
+            if (rng.uniform_int_distribution<int>(0, 99) < glob::positioning::CHANCE_FOR_RNG_BYTES)
             {
-                continue;
+                rngSizeStart = rng.uniform_int_distribution<size_t>(0, hidden::SATELLITE_MAX_RNG_BYTES);
+                rngSizeEnd = rng.uniform_int_distribution<size_t>(0, hidden::SATELLITE_MAX_RNG_BYTES);
             }
-            Eigen::Vector2f diff = unit->m_pos - m_pos;
-            auto diffNorm = diff.norm();
-            if (diffNorm <= m_scanRange)
-            {
-                diff.x() *= -1;
-                float heading = std::atan2(diff.x(), diff.y());
 
-                m_currentUnitScan.push_back({ unit->m_parent->m_gid, unit->m_gid, heading, diffNorm, unit->m_currentHealth, unit->IsHeadquarters() });
+            unsigned char* measurement = m_satellitePackets.Append(rngSizeStart + msgSize + rngSizeEnd);
+
+            for (size_t i = 0; i < rngSizeStart; i++)
+            {
+                measurement[i] = static_cast<unsigned char>(rng.uniform_int_distribution<int>(0, 255));
             }
-        }
-    }
 
-    if (m_parent->m_gid) // Neutral units dont need resources (for now) and satellites
-    {
-        m_currentResourceScan.clear();
-        for (const auto& resource : GameState::resources)
-        {
-            Eigen::Vector2f diff = resource.m_pos - m_pos;
-            auto diffNorm = diff.norm();
-            if (diffNorm <= m_scanRange)
+            measurement[rngSizeStart] = 'C';
+            measurement[rngSizeStart + 1] = '+';
+            measurement[rngSizeStart + 2] = '+';
+            std::memcpy(measurement + rngSizeStart + 3 + 0UL * 4, &satUnitDistance, sizeof(float));
+            std::memcpy(measurement + rngSizeStart + 3 + 1UL * 4, &satellitePos.x(), sizeof(float));
+            std::memcpy(measurement + rngSizeStart + 3 + 2UL * 4, &satellitePos.y(), sizeof(float));
+            union
             {
-                diff.x() *= -1;
-                float heading = std::atan2(diff.x(), diff.y());
+                uint16_t value;
+                std::array<unsigned char, 2> data;
+            } crc{};
+            crc.value = Crc16::Compute(measurement + rngSizeStart, msgSize - 2);
+            if (satellite.m_isFaulty)
+            {
+                crc.value += rng.uniform_int_distribution<uint16_t>(1, std::numeric_limits<uint16_t>::max());
+            }
+            measurement[rngSizeStart + 3 + 3UL * 4 + 0] = crc.data.at(1);
+            measurement[rngSizeStart + 3 + 3UL * 4 + 1] = crc.data.at(0);
 
-                m_currentResourceScan.push_back({ resource.m_gid, heading, diffNorm, resource.m_type, resource.m_amount });
+            for (size_t i = rngSizeStart + msgSize; i < rngSizeStart + msgSize + rngSizeEnd; i++)
+            {
+                measurement[i] = static_cast<unsigned char>(rng.uniform_int_distribution<int>(0, 255));
             }
         }
+    }
+}
 
-        m_currentSatelliteDistanceMeasurement.clear();
-        m_satelliteCount = 0;
-        for (const auto& satellite : GameState::satellites)
+void Unit::UpdateAlways()
+{
+    // The scans are computed when the unit asks for them. A paused world does not change, so they are computed right
+    // away to be shown in the GUI
+    const bool paused = !World::Current().m_gameRunning;
+
+    m_unitScanOutdated = true;
+    if (paused)
+    {
+        UpdateUnitScan();
+    }
+
+    if (m_parent->m_gid) // Neutral units dont need resources (for now) and satellites
+    {
+        m_resourceScanOutdated = true;
+        if (paused)
         {
-            if (float satUnitDistance = (m_pos - (satellite.m_isFaulty ? satellite.m_faultyPos : satellite.m_pos)).norm();
-                satUnitDistance <= glob::positioning::VISIBILITY_RANGE)
-            {
-                if (!satellite.m_isFaulty)
-                {
-                    ++m_satelliteCount;
-                }
-
-                satUnitDistance += static_cast<float>(299'792'458.0 * m_clockOffset);
-
-                constexpr size_t msgSize = 3 * sizeof(char) + 3 * sizeof(float) + sizeof(uint16_t);
-
-                size_t rngSizeStart = 0;
-                size_t rngSizeEnd = 0;
-                if (RandomNumberGenerator::userRngGenerator().uniform_int_distribution<int>(0, 99) < glob::positioning::CHANCE_FOR_RNG_BYTES)
-                {
-                    rngSizeStart = RandomNumberGenerator::userRngGenerator().uniform_int_distribution<size_t>(0, 10);
-                    rngSizeEnd = RandomNumberGenerator::userRngGenerator().uniform_int_distribution<size_t>(0, 10);
-                }
-
-                std::vector<unsigned char> measurement(rngSizeStart + msgSize + rngSizeEnd);
-
-                for (size_t i = 0; i < rngSizeStart; i++)
-                {
-                    measurement.at(i) = static_cast<unsigned char>(RandomNumberGenerator::userRngGenerator().uniform_int_distribution<int>(0, 255));
-                }
-
-                measurement.at(rngSizeStart) = 'C';
-                measurement.at(rngSizeStart + 1) = '+';
-                measurement.at(rngSizeStart + 2) = '+';
-                *reinterpret_cast<float*>(&measurement.at(rngSizeStart + 3 + 0UL * 4)) = satUnitDistance;
-                *reinterpret_cast<float*>(&measurement.at(rngSizeStart + 3 + 1UL * 4)) = satellite.m_pos.x();
-                *reinterpret_cast<float*>(&measurement.at(rngSizeStart + 3 + 2UL * 4)) = satellite.m_pos.y();
-                union
-                {
-                    uint16_t value;
-                    std::array<unsigned char, 2> data;
-                } crc{};
-                crc.value = hidden::computeCrc16(&measurement.at(rngSizeStart), msgSize - 2);
-                if (satellite.m_isFaulty)
-                {
-                    crc.value += RandomNumberGenerator::userRngGenerator().uniform_int_distribution<uint16_t>(1, std::numeric_limits<uint16_t>::max());
-                }
-                measurement.at(rngSizeStart + 3 + 3UL * 4 + 0) = crc.data.at(1);
-                measurement.at(rngSizeStart + 3 + 3UL * 4 + 1) = crc.data.at(0);
-
-                for (size_t i = rngSizeStart + msgSize; i < rngSizeStart + msgSize + rngSizeEnd; i++)
-                {
-                    measurement.at(i) = static_cast<unsigned char>(RandomNumberGenerator::userRngGenerator().uniform_int_distribution<int>(0, 255));
-                }
-
-                m_currentSatelliteDistanceMeasurement.push_back(measurement);
-            }
+            UpdateResourceScan();
         }
+        m_satellitePacketsOutdated = true;
     }
 }
 
+void Unit::MarkScansOutdated()
+{
+    m_unitScanOutdated = true;
+    m_resourceScanOutdated = true;
+    m_satellitePacketsOutdated = true;
+}
+
 void Unit::Update(float deltaTime)
+{
+    UpdateBeforeThink(deltaTime);
+    if (glob::game::RANDOM_STREAMS)
+    {
+        World::UserRngBinding rngBinding(RandomNumberGenerator::userRngGenerator(m_gid, RandomPurpose_Think));
+        Think(deltaTime);
+    }
+    else
+    {
+        Think(deltaTime);
+    }
+    ApplyAction(deltaTime);
+}
+
+void Unit::UpdateBeforeThink(float deltaTime)
 {
     if (IsReloadingWeapons())
     {
@@ -440,46 +506,44 @@ void Unit::Update(float deltaTime)
         m_currentHealth += glob::units::ATTR_HQ_HEAL_AMOUNT * deltaTime;
         m_currentHealth = std::min(m_currentHealth, m_maxHealth);
     }
+}
 
-    Think(deltaTime);
-
+void Unit::ApplyAction(float /* deltaTime */)
+{
     m_actionTooltip = m_action;
 
     if (m_action == Action_Attack && !IsReloadingWeapons())
     {
-        for (auto& player : GameState::players)
+        auto* targetUnit = World::Current().FindUnit(m_actionTargetGid);
+        if (targetUnit
+            && !(m_parent->m_gid                // This unit is a player
+                 && targetUnit->m_parent->m_gid // The target unit is also a player
+                 && !glob::game::ENABLE_PVP)    // PvP is disabled
+            && (m_pos - targetUnit->m_pos).norm() <= m_attackRange)
         {
-            if (m_parent->m_gid             // This unit is a player
-                && player->m_gid            // The target unit is also a player
-                && !glob::game::ENABLE_PVP) // PvP is disabled
-            {
-                break;
-            }
-            for (auto& targetUnit : player->m_units)
-            {
-                if (m_actionTargetGid == targetUnit->m_gid
-                    && (m_pos - targetUnit->m_pos).norm() <= m_attackRange)
-                {
-                    Eigen::Vector2f diff = targetUnit->m_pos - m_pos;
-                    diff.x() *= -1;
-                    m_heading = std::atan2(diff.x(), diff.y());
-
-                    targetUnit->m_currentHealth -= static_cast<float>(m_attackPower);
-                    m_attackBlockTime = glob::units::ATTACK_BLOCK_TIME;
-                    if (GameApplication::controlledCamera)
-                    {
-                        GameApplication::BeginSlowDownGame();
-                    }
-                    m_lastAttackedUnitPosition = targetUnit->m_pos;
-                    break;
-                }
-            }
-            if (IsReloadingWeapons())
-            {
-                break;
-            }
+            Eigen::Vector2f diff = targetUnit->m_pos - m_pos;
+            diff.x() *= -1;
+            AssignHeading(std::atan2(diff.x(), diff.y()));
+
+            targetUnit->m_currentHealth -= static_cast<float>(m_attackPower);
+            m_attackBlockTime = glob::units::ATTACK_BLOCK_TIME;
+            World::Current().m_attackOccurred = true;
+            m_lastAttackedUnitPosition = targetUnit->m_pos;
         }
     }
 }
 
-} // namespace oop::internal
\ No newline at end of file
+void Unit::ApplyMove(float deltaTime)
+{
+    float speed = m_speed - (m_resourcesCarried.second ? glob::units::SPEED_DECREASE_WHILE_CARRYING : 0.0F);
+
+    m_pos.x() = static_cast<float>(std::clamp(m_pos.x() + speed * deltaTime * m_direction.x(),
+                                              glob::game::BOARD_WIDTH.at(0),
+                                              glob::game::BOARD_WIDTH.at(1)));
+
+    m_pos.y() = static_cast<float>(std::clamp(m_pos.y() + speed * deltaTime * m_direction.y(),
+                                              glob::game::BOARD_HEIGHT.at(0),
+                                              glob::game::BOARD_HEIGHT.at(1)));
+}
+
+} // namespace oop::internal
@@ -8,10 +8,12 @@
 #include <Eigen/Core>
 #include <memory>
 #include <array>
+#include <limits>
+#include <string>
 #include <vector>
 
-#include <imgui.h>
 #include "internal/game/resources/Resource.hpp"
+#include "internal/game/positioning/SatellitePackets.hpp"
 
 namespace oop
 {
@@ -56,6 +58,7 @@ struct UnitAttributeModifiers
 namespace internal
 {
 class PlayerBase;
+class UnitSlab;
 
 class Unit
 {
@@ -128,6 +131,9 @@ class Unit
     }
 
     /// @brief Scans the robot surroundings for units
+    ///
+    /// The scan is computed by the first call and then kept till the unit is updated. Called in the Think of the player
+    /// it shows the state at the start of the update, called in the Think of the unit the state when the unit is updated.
     /// @return A list of scan results
     [[nodiscard]] const std::vector<UnitScanResult>& ScanForUnits() const;
 
@@ -148,6 +154,15 @@ class Unit
     /// - the unit receiver offset will be added to all measurements,
     /// - the satellites can append random data to the front,
     /// - the satellites can generate false messages which can be recognized by the checksum.
+    ///
+    /// The packets are views into a buffer of the unit and are valid until the measurements of the next tick. They are
+    /// generated by the first call, so units which do not use the positioning do not pay for it. Like the scans they are
+    /// generated again for the Think of the unit, if the Think of the player already read them.
+    [[nodiscard]] SatellitePacketList GetSatellitePackets() const;
+
+    /// @brief Returns a copy of the Satellite Distance Measurements as separate byte vectors.
+    ///
+    /// Compatibility adapter for GetSatellitePackets() which allocates, so prefer the packet views.
     [[nodiscard]] const std::vector<std::vector<unsigned char>>& GetSatelliteDistanceMeasurements() const;
 
     /// @brief Calculates the resource costs of this unit
@@ -192,22 +207,54 @@ class Unit
     /// @brief Apply the unit Attribute Modifiers.
     void ApplyUnitAttributeModifiers();
 
-    /// @brief Checks whether the unit is the HQ
-    [[nodiscard]] virtual bool IsHeadquarters() const = 0;
+    /// @brief Kind of a unit
+    enum Kind : uint8_t
+    {
+        Kind_Headquarters, ///< HeadquartersBase
+        Kind_Robot,        ///< RobotBase
+        Kind_Virus,        ///< Virus
+    };
 
-    /// @brief Draw the unit
-    virtual void Draw() const;
+    /// @brief Checks whether the unit is the HQ
+    [[nodiscard]] bool IsHeadquarters() const;
 
-    /// @brief Draw an overlay over the unit (can be used for Debugging purposes)
+    /// @brief Draw an overlay over the unit (can be used for Debugging purposes). Never called in headless builds.
     virtual void DrawOverlay() const;
 
-    /// @brief Updates the unit state (no matter if game running or not)
-    /// @param[in] deltaTime Time passed since last update
+    /// @brief Scans for the units in range, using the unit grid of the game state
+    void UpdateUnitScan() const;
+
+    /// @brief Scans for the resources in range, using the resource grid of the game state
+    void UpdateResourceScan() const;
+
+    /// @brief Generates the satellite distance measurements (draws from the user random number generator)
+    void UpdateSatelliteMeasurements() const;
+
+    /// @brief Marks the scans and measurements of the last tick outdated (no matter if game running or not)
     void UpdateAlways();
 
-    /// @brief Updates the unit state
+    /// @brief Marks the scans and measurements outdated without computing them
+    void MarkScansOutdated();
+
+    /// @brief Updates the unit state by preparing it, thinking and applying the planned action
+    /// @param[in] deltaTime Time passed since last update
+    void Update(float deltaTime);
+
+    /// @brief Updates the state of only this unit before it thinks (reloading, healing)
     /// @param[in] deltaTime Time passed since last update
-    virtual void Update(float deltaTime);
+    virtual void UpdateBeforeThink(float deltaTime);
+
+    /// @brief Applies the planned action to the world
+    /// @param[in] deltaTime Time passed since last update
+    virtual void ApplyAction(float deltaTime);
+
+    /// @brief Moves the unit along its heading (slower while carrying resources) and keeps it on the board
+    /// @param[in] deltaTime Time passed since last update
+    void ApplyMove(float deltaTime);
+
+    /// @brief Sets the heading without bias and normalization and caches its direction
+    /// @param[in] heading Heading in [rad] measured from North counter-clockwise
+    void AssignHeading(float heading);
 
     /// @brief Make decisions
     /// @param[in] deltaTime Time passed since last update
@@ -231,6 +278,9 @@ class Unit
     /// Player who owns the unit
     PlayerBase* m_parent;
 
+    /// Kind of the unit (set by the constructor of the base class of the kind, so that it needs no virtual call)
+    Kind m_kind = Kind_Robot;
+
     /// Position of the unit
     Eigen::Vector2f m_pos{ 0.0, 0.0 };
 
@@ -238,6 +288,8 @@ class Unit
     float m_heading = 0.0;
     /// Heading bias of the unit [rad]
     float m_headingBias = 0.0;
+    /// Unit vector of the heading (cos and sin of m_heading + pi/2), which only changes together with the heading
+    Eigen::Vector2d m_direction{ 0.0, 1.0 };
 
     /// Health of the unit [0, m_maxHealth]
     float m_currentHealth = 100.0F;
@@ -255,16 +307,43 @@ class Unit
     double m_clockOffset = 0.0;
 
     /// Last unit scan
-    std::vector<oop::UnitScanResult> m_currentUnitScan;
+    mutable std::vector<oop::UnitScanResult> m_currentUnitScan;
+
+    /// Flag whether the unit scan has to be computed before it is read, as the unit did not ask for it this tick
+    mutable bool m_unitScanOutdated = true;
 
     /// Last resource scan
-    std::vector<ResourceScanResult> m_currentResourceScan;
+    mutable std::vector<ResourceScanResult> m_currentResourceScan;
+
+    /// Flag whether the resource scan has to be computed before it is read, as the unit did not ask for it this tick
+    mutable bool m_resourceScanOutdated = true;
+
+    /// Neighbour list index of units without a list
+    static constexpr size_t NO_NEIGHBOUR_LIST = std::numeric_limits<size_t>::max();
+
+    /// Index of the neighbour list of the unit in the world (NO_NEIGHBOUR_LIST if it was spawned after the lists were built)
+    size_t m_neighbourListIndex = NO_NEIGHBOUR_LIST;
+
+    /// Slab of the unit pool the unit was created in
+    UnitSlab* m_slab = nullptr;
+
+    /// Amount of units checked by the last unit scan before filtering by range
+    mutable size_t m_unitScanCandidates = 0;
+
+    /// Amount of resources checked by the last resource scan before filtering by range
+    mutable size_t m_resourceScanCandidates = 0;
+
+    /// Last satellite distance measurement packets
+    mutable internal::SatellitePacketArena m_satellitePackets;
+
+    /// Flag whether the packets have to be generated before they are read, as the unit did not ask for them this tick
+    mutable bool m_satellitePacketsOutdated = true;
 
-    /// Last satellite distance measurement
-    std::vector<std::vector<unsigned char>> m_currentSatelliteDistanceMeasurement;
+    /// Last satellite distance measurement copied by the compatibility adapter
+    mutable std::vector<std::vector<unsigned char>> m_currentSatelliteDistanceMeasurement;
 
-    /// Number of satellites in range to this unit (not faulty)
-    size_t m_satelliteCount = 0;
+    /// Flag whether the copy of the compatibility adapter needs to be rebuilt from the packets
+    mutable bool m_satelliteDistanceMeasurementOutdated = true;
 
     // -------------------------------------------- Unit Attributes ----------------------------------------------
 
@@ -291,6 +370,14 @@ class Unit
     friend class HeadquartersBase;
     friend class Virus;
     friend class GameState;
+    friend struct RenderState;
+    friend class World;
+    friend class Benchmarks;
+    friend class Replay;
+    friend class Snapshot;
+    friend class MoveIntegrator;
+    friend class UnitSlab;
+    friend struct UnitDeleter;
 };
 
 } // namespace internal
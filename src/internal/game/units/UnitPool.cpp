@@ -0,0 +1,47 @@
+#include "UnitPool.hpp"
+
+#include <algorithm>
+
+#include "internal/game/units/Unit.hpp"
+
+namespace oop::internal
+{
+
+void UnitDeleter::operator()(Unit* unit) const
+{
+    unit->m_slab->Release(unit);
+}
+
+void UnitSlab::Attach(Unit& unit, UnitSlab* slab)
+{
+    unit.m_slab = slab;
+}
+
+Unit* AdoptedUnitSlab::Adopt(const std::shared_ptr<Unit>& unit)
+{
+    m_units.push_back(unit);
+    Attach(*unit, this);
+    return unit.get();
+}
+
+const std::type_info& AdoptedUnitSlab::Type() const
+{
+    return typeid(std::shared_ptr<Unit>);
+}
+
+void AdoptedUnitSlab::Release(Unit* unit)
+{
+    auto iter = std::find_if(m_units.begin(), m_units.end(), [unit](const auto& adopted) { return adopted.get() == unit; });
+    if (iter != m_units.end())
+    {
+        Attach(**iter, nullptr); // The caller can keep a copy of the shared pointer, which outlives the pool
+        m_units.erase(iter);
+    }
+}
+
+UnitPtr UnitPool::Adopt(const std::shared_ptr<Unit>& unit)
+{
+    return UnitPtr(m_adopted.Adopt(unit));
+}
+
+} // namespace oop::internal
@@ -0,0 +1,199 @@
+/// @file UnitPool.hpp
+/// @brief Contiguous storage for the units of every type
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace oop::internal
+{
+// Forward declarations
+class Unit;
+
+/// @brief Returns a unit to the slab it was created in
+struct UnitDeleter
+{
+    /// @brief Destroys the unit and releases its memory
+    /// @param[in] unit Unit to destroy
+    void operator()(Unit* unit) const;
+};
+
+/// @brief Owning pointer to a unit of a UnitPool (single owner, no reference counting)
+using UnitPtr = std::unique_ptr<Unit, UnitDeleter>;
+
+/// @brief Storage of the units of one type
+class UnitSlab
+{
+  public:
+    /// @brief Default constructor
+    UnitSlab() = default;
+    /// @brief Destructor
+    virtual ~UnitSlab() = default;
+    /// @brief Copy constructor
+    UnitSlab(const UnitSlab&) = delete;
+    /// @brief Move constructor
+    UnitSlab(UnitSlab&&) = delete;
+    /// @brief Copy assignment operator
+    UnitSlab& operator=(const UnitSlab&) = delete;
+    /// @brief Move assignment operator
+    UnitSlab& operator=(UnitSlab&&) = delete;
+
+    /// @brief Type of the units in the slab
+    [[nodiscard]] virtual const std::type_info& Type() const = 0;
+
+    /// @brief Destroys the unit and keeps its memory for the next unit
+    /// @param[in] unit Unit created by this slab
+    virtual void Release(Unit* unit) = 0;
+
+  protected:
+    /// @brief Remembers the slab in the unit, so that the deleter finds it
+    /// @param[in, out] unit Unit created by the slab
+    /// @param[in] slab Slab the unit belongs to
+    static void Attach(Unit& unit, UnitSlab* slab);
+};
+
+/// @brief Storage of the units of type T in chunks of consecutive slots.
+///
+/// Released slots are reused first (last in, first out), so the units of a type stay close together in memory.
+/// @tparam T Type of the units
+template<typename T>
+class TypedUnitSlab : public UnitSlab
+{
+  public:
+    /// @brief Constructs a unit in a free slot
+    /// @param[in] args Arguments of the constructor of T
+    template<typename... Args>
+    T* Create(Args&&... args)
+    {
+        if (m_free.empty())
+        {
+            m_chunks.push_back(std::make_unique<Slot[]>(CHUNK_SIZE));
+            m_free.reserve(m_chunks.size() * CHUNK_SIZE);
+            for (size_t i = CHUNK_SIZE; i > 0; i--)
+            {
+                m_free.push_back(&m_chunks.back()[i - 1]);
+            }
+        }
+
+        Slot* slot = m_free.back();
+        T* unit = new (slot->storage) T(std::forward<Args>(args)...);
+        m_free.pop_back();
+        Attach(*unit, this);
+        return unit;
+    }
+
+    /// @copydoc UnitSlab::Type
+    [[nodiscard]] const std::type_info& Type() const override
+    {
+        return typeid(T);
+    }
+
+    /// @copydoc UnitSlab::Release
+    void Release(Unit* unit) override
+    {
+        T* object = static_cast<T*>(unit);
+        object->~T();
+        m_free.push_back(reinterpret_cast<Slot*>(object)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+  private:
+    /// Amount of units in a chunk
+    static constexpr size_t CHUNK_SIZE = 64;
+
+    /// @brief Memory of a unit
+    struct Slot
+    {
+        alignas(T) std::byte storage[sizeof(T)]; ///< Storage of the unit
+    };
+
+    /// Chunks of slots (never moved, as the units are referenced by pointers)
+    std::vector<std::unique_ptr<Slot[]>> m_chunks;
+    /// Free slots, the next one to use at the back
+    std::vector<Slot*> m_free;
+};
+
+/// @brief Keeps units alive which were created outside of the pool as shared pointers
+class AdoptedUnitSlab : public UnitSlab
+{
+  public:
+    /// @brief Takes shared ownership of the unit
+    /// @param[in] unit Unit created outside of the pool
+    Unit* Adopt(const std::shared_ptr<Unit>& unit);
+
+    /// @copydoc UnitSlab::Type
+    [[nodiscard]] const std::type_info& Type() const override;
+
+    /// @copydoc UnitSlab::Release
+    void Release(Unit* unit) override;
+
+  private:
+    /// Adopted units
+    std::vector<std::shared_ptr<Unit>> m_units;
+};
+
+/// @brief Creates the units of a world in a slab per unit type.
+///
+/// The units are owned by UnitPtr, which returns them to their slab. The pool has to outlive all of its units and is
+/// only used by the thread updating the world.
+class UnitPool
+{
+  public:
+    /// @brief Default constructor
+    UnitPool() = default;
+    /// @brief Destructor
+    ~UnitPool() = default;
+    /// @brief Copy constructor
+    UnitPool(const UnitPool&) = delete;
+    /// @brief Move constructor
+    UnitPool(UnitPool&&) = delete;
+    /// @brief Copy assignment operator
+    UnitPool& operator=(const UnitPool&) = delete;
+    /// @brief Move assignment operator
+    UnitPool& operator=(UnitPool&&) = delete;
+
+    /// @brief Constructs a unit in the slab of its type
+    /// @param[in] args Arguments of the constructor of T
+    /// @return Owning pointer to the unit
+    template<typename T, typename... Args>
+    std::unique_ptr<T, UnitDeleter> Create(Args&&... args)
+    {
+        static_assert(std::is_base_of_v<Unit, T>, "The pool only creates units");
+        return std::unique_ptr<T, UnitDeleter>(Slab<T>().Create(std::forward<Args>(args)...));
+    }
+
+    /// @brief Takes over a unit which was created as shared pointer, so that it can be owned like the pooled ones
+    /// @param[in] unit Unit created outside of the pool
+    /// @return Owning pointer to the unit (releases the shared ownership)
+    UnitPtr Adopt(const std::shared_ptr<Unit>& unit);
+
+  private:
+    /// @brief Slab of the unit type (created on first use)
+    template<typename T>
+    TypedUnitSlab<T>& Slab()
+    {
+        for (const auto& slab : m_slabs) // Only a handful of types, so a linear search is fastest
+        {
+            if (slab->Type() == typeid(T))
+            {
+                return static_cast<TypedUnitSlab<T>&>(*slab);
+            }
+        }
+        m_slabs.push_back(std::make_unique<TypedUnitSlab<T>>());
+        return static_cast<TypedUnitSlab<T>&>(*m_slabs.back());
+    }
+
+    /// Slabs of all unit types created so far
+    std::vector<std::unique_ptr<UnitSlab>> m_slabs;
+    /// Units created outside of the pool
+    AdoptedUnitSlab m_adopted;
+};
+
+} // namespace oop::internal
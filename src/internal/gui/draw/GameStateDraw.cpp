@@ -0,0 +1,468 @@
+#include "internal/game/GameState.hpp"
+
+#include <algorithm>
+
+#include <fmt/core.h>
+#include <imgui.h>
+#include <implot.h>
+#include "internal/gui/helper/ImPlotHelper.hpp"
+
+#include "internal/game/Settings.hpp"
+#include "internal/game/units/Unit.hpp"
+
+namespace oop::internal
+{
+
+using gui::helper::ToImColor;
+
+void GameState::Draw()
+{
+    const auto& state = simulation.GetRenderState();
+
+    bool somethingSelected = false;
+    for (const auto& unit : state.units)
+    {
+        if (ImPlot::IsPlotHovered() && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) // Click on unit
+        {
+            Eigen::Vector2f mousePos{ ImPlot::GetPlotMousePos().x, ImPlot::GetPlotMousePos().y };
+            if ((unit.pos - mousePos).norm() <= unit.drawSize * glob::gui::HOVER_OBJECT_SIZE_MODIFIER)
+            {
+                selectedGid = unit.gid;
+                somethingSelected = true;
+            }
+        }
+        unit.Draw(state, unit.gid == selectedGid);
+    }
+
+    for (const auto& resource : state.resources)
+    {
+        if (ImPlot::IsPlotHovered() && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) // Click on unit
+        {
+            Eigen::Vector2f mousePos{ ImPlot::GetPlotMousePos().x, ImPlot::GetPlotMousePos().y };
+            if ((resource.pos - mousePos).norm() <= resource.drawSize * glob::gui::HOVER_OBJECT_SIZE_MODIFIER)
+            {
+                selectedGid = resource.gid;
+                somethingSelected = true;
+            }
+        }
+
+        resource.Draw(resource.gid == selectedGid);
+    }
+
+    for (const auto& satellite : state.satellites)
+    {
+        if (ImPlot::IsPlotHovered() && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) // Click on unit
+        {
+            Eigen::Vector2f mousePos{ ImPlot::GetPlotMousePos().x, ImPlot::GetPlotMousePos().y };
+            if ((satellite.pos - mousePos).norm() <= Satellite::m_size * glob::gui::HOVER_OBJECT_SIZE_MODIFIER)
+            {
+                selectedGid = satellite.gid;
+                somethingSelected = true;
+            }
+        }
+
+        satellite.Draw(satellite.gid == selectedGid);
+    }
+
+    if (!somethingSelected && ImPlot::IsPlotHovered() && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) // Click into empty space
+    {
+        selectedGid = 0;
+    }
+
+    DrawOverlays();
+}
+
+void GameState::DrawOverlays()
+{
+    // The overlays are code of the teams, which reads the units themselves. So they are only drawn while the simulation
+    // thread does not update the world, which is always the case while the game is paused
+    const auto lock = simulation.TryLockWorld();
+    if (!lock.owns_lock())
+    {
+        return;
+    }
+
+    World::Scope scope(world);
+    // Satellite packets generated by the overlays must not draw from the generator of the match, otherwise the course of
+    // the game would depend on the frame rate. The scans and packets are computed again for the next update anyway
+    RandomNumberGenerator overlayRng;
+    World::UserRngBinding rngBinding(overlayRng);
+    for (const auto& player : world.m_players)
+    {
+        for (const auto& unit : player->m_units)
+        {
+            unit->DrawOverlay();
+        }
+    }
+}
+
+void GameState::DrawGameStats(float availableWidth)
+{
+    const auto& state = simulation.GetRenderState();
+
+    constexpr float heightPlayer = 150.0F;
+    constexpr float heightPlayerVirus = 75.0F;
+    float heightTooltip = 0;
+
+    const RenderState::UnitView* selectedUnit = nullptr;
+    const RenderState::ResourceView* selectedResource = nullptr;
+    const RenderState::SatelliteView* selectedSatellite = nullptr;
+    if (selectedGid)
+    {
+        auto isSelected = [](const auto& object) { return object.gid == selectedGid; };
+        if (auto unit = std::find_if(state.units.begin(), state.units.end(), isSelected); unit != state.units.end())
+        {
+            selectedUnit = &*unit;
+        }
+        else if (auto resource = std::find_if(state.resources.begin(), state.resources.end(), isSelected); resource != state.resources.end())
+        {
+            selectedResource = &*resource;
+        }
+        else if (auto satellite = std::find_if(state.satellites.begin(), state.satellites.end(), isSelected); satellite != state.satellites.end())
+        {
+            selectedSatellite = &*satellite;
+        }
+    }
+
+    if (selectedUnit)
+    {
+        const auto& unit = selectedUnit;
+        if (unit->playerGid) // Player
+        {
+            if (unit->kind == RenderState::UnitKind_Headquarters)
+            {
+                heightTooltip = 210;
+            }
+            else
+            {
+                heightTooltip = 320;
+            }
+        }
+        else // Neutral
+        {
+            heightTooltip = 235;
+        }
+    }
+
+    else if (selectedResource)
+    {
+        heightTooltip = 90;
+    }
+    else if (selectedSatellite)
+    {
+        const auto& satellite = selectedSatellite;
+        heightTooltip = satellite->isFaulty ? 180 : 140;
+    }
+
+    float heightStats = 55 // Elapsed Time
+                        + ImGui::GetStyle().WindowPadding.y
+                        + (glob::game::NEUTRAL_UNITS ? heightPlayerVirus : 0)
+                        + ImGui::GetStyle().WindowPadding.y
+                        + heightPlayer * glob::game::NUM_PLAYERS
+                        + (heightTooltip > 0 ? ImGui::GetStyle().WindowPadding.y / 2.0F + heightTooltip : 0.0F);
+
+    ImGui::BeginChild("ControlPanel Stats", ImVec2(availableWidth, heightStats), true); // 750
+
+    int gameTimeHours = static_cast<int>(state.gameTime / 3600.0F);
+    int gameTimeMin = static_cast<int>(state.gameTime / 60) - gameTimeHours * 60;
+    int gameTimeSec = static_cast<int>(state.gameTime) - gameTimeHours * 3600 - gameTimeMin * 60;
+    int gameTimeMs = static_cast<int>((state.gameTime - std::floor(state.gameTime)) * 1e3F);
+
+    ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[3]);
+    ImGui::TextUnformatted(fmt::format("Elapsed Time {:02d}:{:02d}:{:02d}.{:03d}", gameTimeHours, gameTimeMin, gameTimeSec, gameTimeMs).c_str());
+    ImGui::PopFont();
+
+    // ###########################################################################################################
+    //                                               Player Stats
+    // ###########################################################################################################
+
+    for (const auto& player : state.players)
+    {
+        if (!player.gid && !glob::game::NEUTRAL_UNITS)
+        {
+            continue;
+        }
+
+        ImGui::BeginChild(fmt::format("ControlPanel Stats Player {}", player.gid).c_str(),
+                          ImVec2(availableWidth - 2.0F * ImGui::GetStyle().WindowPadding.x, player.gid ? heightPlayer : heightPlayerVirus), true);
+
+        ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[2]);
+        ImGui::TextUnformatted(player.gid ? player.name.c_str() : "Virus");
+        ImGui::PopFont();
+        ImGui::SameLine();
+        ImGui::ColorButton(fmt::format("##player color {}", player.gid).c_str(), ToImColor(player.color).Value, ImGuiColorEditFlags_NoTooltip, ImVec2(30, 30));
+
+        if (ImGui::BeginTable("##player stats", 2, ImGuiTableFlags_None))
+        {
+            ImGui::TableSetupColumn("", ImGuiTableColumnFlags_WidthFixed, 50.0F);
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Units");
+            ImGui::TableNextColumn();
+            ImGui::Text("%lu", player.unitCount - (player.gid ? 1 : 0));
+
+            // TODO: Killed count
+            // TODO: Lost count
+
+            ImGui::EndTable();
+        }
+
+        if (player.gid)
+        {
+            ImGui::SetCursorPosY(ImGui::GetCursorPosY() + 5.0F);
+
+            if (ImGui::BeginTable(fmt::format("##player resources table {}", player.gid).c_str(), 4, ImGuiTableFlags_Borders))
+            {
+                ImGui::TableSetupColumn("", ImGuiTableColumnFlags_WidthFixed, 50.0F);
+                ImGui::TableSetupColumn("Capacitors");
+                ImGui::TableSetupColumn("Coils");
+                ImGui::TableSetupColumn("Resistors");
+                ImGui::TableHeadersRow();
+
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("Current");
+
+                for (size_t n = 0; n < ResourceType_COUNT; n++)
+                {
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(fmt::format("{}", player.resources.at(n)).c_str());
+                }
+
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("Total");
+                for (size_t n = 0; n < ResourceType_COUNT; n++)
+                {
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(fmt::format("{}", player.collectedResourcesTotal.at(n)).c_str());
+                }
+                ImGui::EndTable();
+            }
+        }
+
+        ImGui::EndChild();
+    }
+
+    // ###########################################################################################################
+    //                                                  Tooltip
+    // ###########################################################################################################
+    if (selectedUnit)
+    {
+        const auto& unit = selectedUnit;
+
+        ImGui::BeginChild("ControlPanel Selected Object",
+                          ImVec2(availableWidth - 2.0F * ImGui::GetStyle().WindowPadding.x, heightTooltip), true);
+
+        bool isHQ = unit->kind == RenderState::UnitKind_Headquarters;
+
+        ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[2]);
+        ImGui::TextColored(ToImColor(unit->color), "%s", fmt::format("[{}] {}", unit->gid, unit->typeName).c_str());
+        ImGui::PopFont();
+
+        ImGui::PushStyleColor(ImGuiCol_PlotHistogram, ImVec4{ 1.0F - unit->currentHealth / unit->maxHealth, unit->currentHealth / unit->maxHealth, 0.0F, 1.0F });
+        ImGui::ProgressBar(unit->currentHealth / unit->maxHealth, ImVec2(availableWidth - 4.0F * ImGui::GetStyle().WindowPadding.x, 0),
+                           fmt::format("Health: {:.1f} / {:.1f}", unit->currentHealth, unit->maxHealth).c_str());
+        ImGui::SameLine();
+        ImGui::TextUnformatted("Health");
+        ImGui::PopStyleColor();
+
+        if (ImGui::BeginTable("##unit stats", 2, ImGuiTableFlags_None))
+        {
+            auto actionToString = [](Unit::Action action) {
+                switch (action)
+                {
+                case oop::internal::Unit::Action_None:
+                    return "Nothing";
+                case oop::internal::Unit::Action_Move:
+                    return "Moving";
+                case oop::internal::Unit::Action_Attack:
+                    return "Attacking";
+                case oop::internal::Unit::Action_CollectResource:
+                    return "Collecting resources";
+                case oop::internal::Unit::Action_DropOffResourcesAtHQ:
+                    return "Dropping resources off at HQ";
+                case oop::internal::Unit::Action_DiscardResources:
+                    return "Discarding resources";
+                }
+                return "Nothing";
+            };
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Action");
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", actionToString(unit->action));
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Position");
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f | %.2f", unit->pos.x(), unit->pos.y());
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Heading");
+            ImGui::TableNextColumn();
+            if (glob::game::ENABLE_HEADING_PRECISION)
+            {
+                ImGui::Text("%.1f° ± %.1f°", unit->heading * 180.0F / static_cast<float>(M_PI), unit->headingBias * 180.0F / static_cast<float>(M_PI));
+            }
+            else
+            {
+                ImGui::Text("%.1f°", unit->heading * 180.0F / static_cast<float>(M_PI));
+            }
+
+            if (!isHQ && unit->playerGid)
+            {
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("Carried Resources");
+                ImGui::TableNextColumn();
+                if (unit->resourcesCarried.second)
+                {
+                    ImGui::Text("%s - %lu", Resource::GetTypeName(unit->resourcesCarried.first).c_str(), unit->resourcesCarried.second);
+                }
+                else
+                {
+                    ImGui::TextUnformatted("None");
+                }
+
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("Satellites");
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", unit->satelliteCount);
+            }
+
+            ImGui::TableNextRow();
+            ImGui::TableNextRow();
+
+            if (!isHQ)
+            {
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("Speed");
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", unit->speed - (unit->resourcesCarried.second ? glob::units::SPEED_DECREASE_WHILE_CARRYING : 0.0F));
+            }
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Scan range");
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", unit->scanRange);
+
+            if (!isHQ && unit->playerGid)
+            {
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("Collect range");
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", unit->collectRange);
+
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("Container size");
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", unit->resourceContainerSize);
+            }
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Attack power");
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", unit->attackPower);
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Attack range");
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", unit->attackRange);
+
+            if (!isHQ && glob::game::ENABLE_DISTANCE_CLOCK_OFFSET)
+            {
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("Clock offset");
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3e", unit->clockOffset);
+            }
+
+            ImGui::EndTable();
+        }
+
+        ImGui::EndChild();
+    }
+    else if (selectedResource)
+    {
+        ImGui::BeginChild("ControlPanel Selected Object", ImVec2(availableWidth - 2.0F * ImGui::GetStyle().WindowPadding.x, heightTooltip), true);
+
+        const auto& resource = selectedResource;
+        ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[2]);
+        ImGui::TextColored(ToImColor(Resource::color(resource->type)), "%s", fmt::format("[{}] {}", resource->gid, Resource::GetTypeName(resource->type)).c_str());
+        ImGui::PopFont();
+
+        if (ImGui::BeginTable("##resource stats", 2, ImGuiTableFlags_None))
+        {
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Position");
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f | %.2f", resource->pos.x(), resource->pos.y());
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Amount");
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", resource->amount);
+
+            ImGui::EndTable();
+        }
+
+        ImGui::EndChild();
+    }
+    else if (selectedSatellite)
+    {
+        ImGui::BeginChild("ControlPanel Selected Object", ImVec2(availableWidth - 2.0F * ImGui::GetStyle().WindowPadding.x, heightTooltip), true);
+
+        const auto& satellite = selectedSatellite;
+        ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[2]);
+        ImGui::TextColored(ToImColor(Satellite::m_color), "[%zu] Satellite", satellite->gid);
+        ImGui::PopFont();
+
+        if (ImGui::BeginTable("##satellite stats", 2, ImGuiTableFlags_None))
+        {
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Position");
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f | %.2f", satellite->pos.x(), satellite->pos.y());
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Speed");
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", satellite->speed);
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Heading");
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f°", satellite->heading * 180.0F / static_cast<float>(M_PI));
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Faulty");
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(satellite->isFaulty ? "true" : "false");
+
+            if (satellite->isFaulty)
+            {
+                ImGui::TableNextColumn();
+                ImGui::Indent();
+                ImGui::TextUnformatted("Position");
+                ImGui::Unindent();
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f | %.2f", satellite->faultyPos.x(), satellite->faultyPos.y());
+
+                ImGui::TableNextColumn();
+                ImGui::Indent();
+                ImGui::TextUnformatted("Speed");
+                ImGui::Unindent();
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", satellite->faultySpeed);
+            }
+
+            ImGui::EndTable();
+        }
+
+        ImGui::EndChild();
+    }
+
+    // ImGui::TextUnformatted(fmt::format("Elapsed Time {:02d}:{:02d}:{:02d}.{:03d}", gameTimeHours, gameTimeMin, gameTimeSec, gameTimeMs).c_str());
+
+    ImGui::EndChild();
+}
+
+} // namespace oop::internal
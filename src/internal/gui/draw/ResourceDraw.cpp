@@ -0,0 +1,122 @@
+#include "internal/game/RenderState.hpp"
+
+#include <fmt/core.h>
+#include <implot.h>
+#include "internal/gui/helper/ImPlotHelper.hpp"
+#include "internal/GameApplication.hpp"
+#include "internal/game/Settings.hpp"
+
+namespace oop::internal
+{
+
+void RenderState::ResourceView::Draw(bool selected) const
+{
+    using oop::internal::gui::helper::Rotate;
+    using oop::internal::gui::helper::PlotToPixel;
+    using oop::internal::gui::helper::ToImColor;
+
+    auto drawBackgroundShape = [this](const ImColor& color) {
+        Eigen::Vector2f TL = pos
+                             + Rotate({ -0.4F * drawSize - glob::gui::HOVER_OBJECT_SIZE_MODIFIER,
+                                        0.2F * drawSize + glob::gui::HOVER_OBJECT_SIZE_MODIFIER },
+                                      heading);
+        Eigen::Vector2f TR = pos
+                             + Rotate({ 0.4F * drawSize + glob::gui::HOVER_OBJECT_SIZE_MODIFIER,
+                                        0.2F * drawSize + glob::gui::HOVER_OBJECT_SIZE_MODIFIER },
+                                      heading);
+        Eigen::Vector2f BL = pos
+                             + Rotate({ -0.4F * drawSize - glob::gui::HOVER_OBJECT_SIZE_MODIFIER,
+                                        -0.2F * drawSize - glob::gui::HOVER_OBJECT_SIZE_MODIFIER },
+                                      heading);
+        Eigen::Vector2f BR = pos
+                             + Rotate({ 0.4F * drawSize + glob::gui::HOVER_OBJECT_SIZE_MODIFIER,
+                                        -0.2F * drawSize - glob::gui::HOVER_OBJECT_SIZE_MODIFIER },
+                                      heading);
+        ImPlot::GetPlotDrawList()->AddQuadFilled(ImPlot::PlotToPixels(TL.x(), TL.y()),
+                                                 ImPlot::PlotToPixels(TR.x(), TR.y()),
+                                                 ImPlot::PlotToPixels(BR.x(), BR.y()),
+                                                 ImPlot::PlotToPixels(BL.x(), BL.y()),
+                                                 color);
+    };
+
+    if (selected)
+    {
+        drawBackgroundShape(ToImColor(glob::gui::COLOR_SELECTED));
+    }
+    else if (ImPlot::IsPlotHovered()
+             && (pos - Eigen::Vector2f{ ImPlot::GetPlotMousePos().x, ImPlot::GetPlotMousePos().y })
+                        .norm()
+                    <= drawSize * glob::gui::HOVER_OBJECT_SIZE_MODIFIER)
+    {
+        drawBackgroundShape(ToImColor(glob::gui::COLOR_HOVERED));
+    }
+
+    if (type == ResourceType_Capacitor)
+    {
+        Eigen::Vector2f L = pos + Rotate({ -0.5F * drawSize, 0 }, heading);
+        Eigen::Vector2f R = pos + Rotate({ 0.5F * drawSize, 0 }, heading);
+
+        Eigen::Vector2f LC = pos + Rotate({ -0.1F * drawSize, 0 }, heading);
+        Eigen::Vector2f RC = pos + Rotate({ 0.1F * drawSize, 0 }, heading);
+
+        Eigen::Vector2f LT = pos + Rotate({ -0.1F * drawSize, 0.3F * drawSize }, heading);
+        Eigen::Vector2f RT = pos + Rotate({ 0.1F * drawSize, 0.3F * drawSize }, heading);
+
+        Eigen::Vector2f LB = pos + Rotate({ -0.1F * drawSize, -0.3F * drawSize }, heading);
+        Eigen::Vector2f RB = pos + Rotate({ 0.1F * drawSize, -0.3F * drawSize }, heading);
+
+        ImPlot::GetPlotDrawList()->AddLine(ImPlot::PlotToPixels(L.x(), L.y()), ImPlot::PlotToPixels(LC.x(), LC.y()), ToImColor(Resource::color(type)), 1.5F);
+        ImPlot::GetPlotDrawList()->AddLine(ImPlot::PlotToPixels(R.x(), R.y()), ImPlot::PlotToPixels(RC.x(), RC.y()), ToImColor(Resource::color(type)), 1.5F);
+        ImPlot::GetPlotDrawList()->AddLine(ImPlot::PlotToPixels(LT.x(), LT.y()), ImPlot::PlotToPixels(LB.x(), LB.y()), ToImColor(Resource::color(type)), 1.5F);
+        ImPlot::GetPlotDrawList()->AddLine(ImPlot::PlotToPixels(RT.x(), RT.y()), ImPlot::PlotToPixels(RB.x(), RB.y()), ToImColor(Resource::color(type)), 1.5F);
+    }
+    else if (type == ResourceType_Coil)
+    {
+        Eigen::Vector2f upperLeft = pos + Eigen::Vector2f{ -0.5F * drawSize, 0.5F * drawSize * 417.0 / 1909.0 };
+        Eigen::Vector2f lowerRright = pos + Eigen::Vector2f{ 0.5F * drawSize, -0.5F * drawSize * 417.0 / 1909.0 };
+
+        ImPlot::GetPlotDrawList()->AddImage(GameApplication::coilTexture,
+                                            ImPlot::PlotToPixels(upperLeft.x(), upperLeft.y()),
+                                            ImPlot::PlotToPixels(lowerRright.x(), lowerRright.y()));
+    }
+    else if (type == ResourceType_Resistor)
+    {
+        Eigen::Vector2f L = pos + Rotate({ -0.5F * drawSize, 0 }, heading);
+        Eigen::Vector2f R = pos + Rotate({ 0.5F * drawSize, 0 }, heading);
+
+        Eigen::Vector2f LC = pos + Rotate({ -0.3F * drawSize, 0 }, heading);
+        Eigen::Vector2f RC = pos + Rotate({ 0.3F * drawSize, 0 }, heading);
+
+        Eigen::Vector2f p_min = pos + Rotate({ -0.3F * drawSize, 0.15F * drawSize }, heading);
+        Eigen::Vector2f p_max = pos + Rotate({ 0.3F * drawSize, -0.15F * drawSize }, heading);
+
+        ImPlot::GetPlotDrawList()->AddLine(ImPlot::PlotToPixels(L.x(), L.y()), ImPlot::PlotToPixels(LC.x(), LC.y()), ToImColor(Resource::color(type)), 2.0F);
+        ImPlot::GetPlotDrawList()->AddLine(ImPlot::PlotToPixels(R.x(), R.y()), ImPlot::PlotToPixels(RC.x(), RC.y()), ToImColor(Resource::color(type)), 2.0F);
+        ImPlot::GetPlotDrawList()->AddRect(ImPlot::PlotToPixels(p_min.x(), p_min.y()), ImPlot::PlotToPixels(p_max.x(), p_max.y()), ToImColor(Resource::color(type)), 0.0F, ImDrawFlags_None, 2.0F);
+    }
+
+    ImPlot::PushStyleColor(ImPlotCol_InlayText, ToImColor(Resource::color(type)).Value);
+    ImPlot::PlotText(fmt::format("{}", amount).c_str(), pos.x() + drawSize * 3.0 / 4.0, pos.y() + drawSize * 3.0 / 4.0);
+    ImPlot::PopStyleColor();
+
+    // ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(pos.x(), pos.y()), PlotToPixel(0.1), ImColor{ 255, 0, 0 });
+
+    if (glob::debug::DRAW_SPAWN_BOUNDARIES)
+    {
+        ImPlot::GetPlotDrawList()->AddCircle(ImPlot::PlotToPixels(pos.x(), pos.y()), static_cast<float>(PlotToPixel(glob::resources::MIN_DISTANCE_RESOURCE_TO_RESOURCE)), ImColor{ 255, 0, 0, 120 });
+    }
+    if (glob::debug::DRAW_ENTITY_POSITIONS)
+    {
+        ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(pos.x(), pos.y()), static_cast<float>(PlotToPixel(0.1)), ImColor{ 255, 0, 0 });
+    }
+    if (glob::debug::DRAW_GID)
+    {
+        auto col = ToImColor(Resource::color(type)).Value;
+        col.w = 0.7F;
+        ImPlot::PushStyleColor(ImPlotCol_InlayText, col);
+        ImPlot::PlotText(fmt::format("{}", gid).c_str(), pos.x() - drawSize * 3.0 / 5.0, pos.y() - drawSize * 3.0 / 5.0);
+        ImPlot::PopStyleColor();
+    }
+}
+
+} // namespace oop::internal
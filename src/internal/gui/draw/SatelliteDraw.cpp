@@ -0,0 +1,71 @@
+#include "internal/game/RenderState.hpp"
+
+#include <fmt/core.h>
+#include <implot.h>
+#include "internal/gui/helper/ImPlotHelper.hpp"
+#include "internal/GameApplication.hpp"
+#include "internal/game/positioning/Satellite.hpp"
+#include "internal/game/Settings.hpp"
+
+namespace oop::internal
+{
+
+void RenderState::SatelliteView::Draw(bool selected) const
+{
+    using oop::internal::gui::helper::PlotToPixel;
+    using oop::internal::gui::helper::ToImColor;
+
+    auto drawBackgroundShape = [this](const ImColor& color) {
+        ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(pos.x(), pos.y()),
+                                                   0.7F * static_cast<float>(PlotToPixel(Satellite::m_size)), color);
+    };
+
+    if (selected)
+    {
+        drawBackgroundShape(ToImColor(glob::gui::COLOR_SELECTED));
+    }
+    else if (ImPlot::IsPlotHovered()
+             && (pos - Eigen::Vector2f{ ImPlot::GetPlotMousePos().x, ImPlot::GetPlotMousePos().y })
+                        .norm()
+                    <= Satellite::m_size * glob::gui::HOVER_OBJECT_SIZE_MODIFIER)
+    {
+        drawBackgroundShape(ToImColor(glob::gui::COLOR_HOVERED));
+    }
+
+    if (isFaulty)
+    {
+        ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(pos.x(), pos.y()),
+                                                   0.8F * static_cast<float>(PlotToPixel(Satellite::m_size)), ImColor{ 255, 0, 0, 50 });
+
+        Eigen::Vector2f upperLeft = faultyPos + Eigen::Vector2f{ -0.2F * Satellite::m_size, 0.2F * Satellite::m_size };
+        Eigen::Vector2f lowerRright = faultyPos + Eigen::Vector2f{ 0.2F * Satellite::m_size, -0.2F * Satellite::m_size };
+        ImPlot::GetPlotDrawList()->AddImage(GameApplication::satelliteTexture,
+                                            ImPlot::PlotToPixels(upperLeft.x(), upperLeft.y()),
+                                            ImPlot::PlotToPixels(lowerRright.x(), lowerRright.y()));
+    }
+
+    Eigen::Vector2f upperLeft = pos + Eigen::Vector2f{ -0.5F * Satellite::m_size, 0.5F * Satellite::m_size };
+    Eigen::Vector2f lowerRright = pos + Eigen::Vector2f{ 0.5F * Satellite::m_size, -0.5F * Satellite::m_size };
+    ImPlot::GetPlotDrawList()->AddImage(GameApplication::satelliteTexture,
+                                        ImPlot::PlotToPixels(upperLeft.x(), upperLeft.y()),
+                                        ImPlot::PlotToPixels(lowerRright.x(), lowerRright.y()));
+
+    if (glob::debug::DRAW_SATELLITE_VISIBILITY_RANGE)
+    {
+        ImPlot::GetPlotDrawList()->AddCircle(ImPlot::PlotToPixels(pos.x(), pos.y()), static_cast<float>(PlotToPixel(glob::positioning::VISIBILITY_RANGE)), ImColor{ 255, 229, 204 });
+    }
+    if (glob::debug::DRAW_ENTITY_POSITIONS)
+    {
+        ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(pos.x(), pos.y()), static_cast<float>(PlotToPixel(0.1)), ImColor{ 255, 0, 0 });
+    }
+    if (glob::debug::DRAW_GID)
+    {
+        auto col = ToImColor(Satellite::m_color).Value;
+        col.w = 0.7F;
+        ImPlot::PushStyleColor(ImPlotCol_InlayText, col);
+        ImPlot::PlotText(fmt::format("{}", gid).c_str(), pos.x() - Satellite::m_size * 3.0 / 5.0, pos.y() - Satellite::m_size * 3.0 / 5.0);
+        ImPlot::PopStyleColor();
+    }
+}
+
+} // namespace oop::internal
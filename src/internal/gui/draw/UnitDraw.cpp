@@ -0,0 +1,260 @@
+#include "internal/game/RenderState.hpp"
+
+#include <fmt/format.h>
+#include <implot.h>
+#include "internal/gui/helper/ImPlotHelper.hpp"
+
+#include "internal/GameApplication.hpp"
+#include "internal/game/Settings.hpp"
+
+namespace oop::internal
+{
+
+void RenderState::UnitView::Draw(const RenderState& state, bool selected) const
+{
+    DrawCommon(state);
+    switch (kind)
+    {
+    case UnitKind_Headquarters:
+        DrawHeadquarters(selected);
+        break;
+    case UnitKind_Robot:
+        DrawRobot(selected);
+        break;
+    case UnitKind_Virus:
+        DrawVirus(selected);
+        break;
+    }
+}
+
+void RenderState::UnitView::DrawCommon(const RenderState& state) const
+{
+    using internal::gui::helper::PlotToPixel;
+    using internal::gui::helper::ToImColor;
+
+    if (glob::debug::DRAW_UNIT_HEALTH_BAR)
+    {
+        ImPlot::GetPlotDrawList()->AddRectFilled(ImPlot::PlotToPixels(pos.x() - drawSize * 3.0 / 7.0,
+                                                                      pos.y() + drawSize * 3.0 / 4.0 + 0.1),
+                                                 ImPlot::PlotToPixels(pos.x() + drawSize * 3.0 / 7.0,
+                                                                      pos.y() + drawSize * 3.0 / 4.0 - 0.1),
+                                                 ImColor{ 100, 100, 100 });
+        ImPlot::GetPlotDrawList()->AddRectFilled(ImPlot::PlotToPixels(pos.x() - drawSize * 3.0 / 7.0 + 0.03,
+                                                                      pos.y() + drawSize * 3.0 / 4.0 + 0.07),
+                                                 ImPlot::PlotToPixels(pos.x() + (drawSize * 3.0 / 7.0 - 0.03) * (2 * currentHealth / maxHealth - 1),
+                                                                      pos.y() + drawSize * 3.0 / 4.0 - 0.07),
+                                                 ImColor{ 1.0F - currentHealth / maxHealth, currentHealth / maxHealth, 0.0F });
+    }
+    if (glob::debug::DRAW_GID)
+    {
+        auto col = ToImColor(color).Value;
+        col.w = 0.7F;
+        ImPlot::PushStyleColor(ImPlotCol_InlayText, col);
+        ImPlot::PlotText(fmt::format("{}", gid).c_str(), pos.x() - drawSize * 3.0 / 5.0, pos.y() - drawSize * 3.0 / 5.0);
+        ImPlot::PopStyleColor();
+    }
+
+    if (glob::debug::DRAW_UNIT_SCAN_RANGE)
+    {
+        auto col = ToImColor(color);
+        col.Value.w = 0.4F;
+        ImPlot::GetPlotDrawList()->AddCircle(ImPlot::PlotToPixels(pos.x(), pos.y()), static_cast<float>(PlotToPixel(scanRange)), col);
+    }
+    if (glob::debug::DRAW_UNIT_ATTACK_RANGE)
+    {
+        ImPlot::GetPlotDrawList()->AddCircle(ImPlot::PlotToPixels(pos.x(), pos.y()), static_cast<float>(PlotToPixel(attackRange)), ImColor{ 255, 0, 0, 120 });
+    }
+
+    if (glob::debug::DRAW_OBJECTS_IN_SCAN_RANGE)
+    {
+        for (size_t i = scanLinesBegin; i < scanLinesBegin + scanLinesCount; i++)
+        {
+            const auto& scanLine = state.scanLines[i];
+            auto col = ToImColor(scanLine.color);
+            col.Value.w = 0.3F;
+            ImPlot::GetPlotDrawList()->AddLine(ImPlot::PlotToPixels(pos.x(), pos.y()),
+                                               ImPlot::PlotToPixels(scanLine.target.x(), scanLine.target.y()), col);
+        }
+    }
+
+    if (glob::debug::DRAW_SATELLITE_COUNT_ON_UNITS && playerGid)
+    {
+        ImPlot::PushStyleColor(ImPlotCol_InlayText, ToImColor(color).Value);
+        ImPlot::PlotText(fmt::format("{}", satelliteCount).c_str(), pos.x() + drawSize * 3.0 / 4.0, pos.y() + drawSize * 3.0 / 4.0);
+        ImPlot::PopStyleColor();
+    }
+
+    if (glob::debug::DRAW_ENTITY_POSITIONS)
+    {
+        ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(pos.x(), pos.y()), static_cast<float>(PlotToPixel(0.1)), ImColor{ 255, 0, 0 });
+    }
+
+    if (constexpr float attackAnimationDuration = glob::units::ATTACK_BLOCK_TIME - 0.8F;
+        attackBlockTime > attackAnimationDuration)
+    {
+        ImPlot::GetPlotDrawList()->AddLine(ImPlot::PlotToPixels(pos.x(), pos.y()),
+                                           ImPlot::PlotToPixels(lastAttackedUnitPosition.x(), lastAttackedUnitPosition.y()),
+                                           ImColor{ 1.0F, 0.0F, 0.0F, (attackBlockTime - attackAnimationDuration) / (1.0F - attackAnimationDuration) });
+        if (GameApplication::controlledCamera)
+        {
+            ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(lastAttackedUnitPosition.x(), lastAttackedUnitPosition.y()),
+                                                       static_cast<float>(PlotToPixel(4.0)),
+                                                       ImColor{ 1.0F, 0.0F, 0.0F, 0.3F });
+        }
+    }
+}
+
+
+void RenderState::UnitView::DrawRobot(bool selected) const
+{
+    using internal::gui::helper::Rotate;
+    using internal::gui::helper::PlotToPixel;
+    using internal::gui::helper::ToImColor;
+
+    auto drawBackgroundShape = [this](const ImColor& backgroundColor) {
+        Eigen::Vector2f M2 = pos + Rotate({ 0, 2.0 / 3.0 * drawSize + glob::gui::HOVER_OBJECT_SIZE_MODIFIER }, heading);
+        Eigen::Vector2f L2 = pos
+                             + Rotate({ -drawSize * std::tan(M_PI / 180.0 * 20) - glob::gui::HOVER_OBJECT_SIZE_MODIFIER,
+                                        -1.0 / 3.0 * drawSize - glob::gui::HOVER_OBJECT_SIZE_MODIFIER },
+                                      heading);
+        Eigen::Vector2f N2 = pos
+                             + Rotate({ drawSize * std::tan(M_PI / 180.0 * 20) + glob::gui::HOVER_OBJECT_SIZE_MODIFIER,
+                                        -1.0 / 3.0 * drawSize - 0.05 },
+                                      heading);
+        ImPlot::GetPlotDrawList()->AddTriangleFilled(ImPlot::PlotToPixels(M2.x(), M2.y()),
+                                                     ImPlot::PlotToPixels(N2.x(), N2.y()),
+                                                     ImPlot::PlotToPixels(L2.x(), L2.y()),
+                                                     backgroundColor);
+    };
+
+    if (selected)
+    {
+        drawBackgroundShape(ToImColor(glob::gui::COLOR_SELECTED));
+    }
+    else if (ImPlot::IsPlotHovered()
+             && (pos - Eigen::Vector2f{ ImPlot::GetPlotMousePos().x, ImPlot::GetPlotMousePos().y })
+                        .norm()
+                    <= drawSize * glob::gui::HOVER_OBJECT_SIZE_MODIFIER)
+    {
+        drawBackgroundShape(ToImColor(glob::gui::COLOR_HOVERED));
+    }
+
+    Eigen::Vector2f M = pos + Rotate({ 0, 2.0 / 3.0 * drawSize }, heading);
+    Eigen::Vector2f L = pos + Rotate({ -drawSize * std::tan(M_PI / 180.0 * 20), -1.0 / 3.0 * drawSize }, heading);
+    Eigen::Vector2f N = pos + Rotate({ drawSize * std::tan(M_PI / 180.0 * 20), -1.0 / 3.0 * drawSize }, heading);
+    ImPlot::GetPlotDrawList()->AddTriangleFilled(ImPlot::PlotToPixels(M.x(), M.y()),
+                                                 ImPlot::PlotToPixels(N.x(), N.y()),
+                                                 ImPlot::PlotToPixels(L.x(), L.y()),
+                                                 ToImColor(color));
+
+    if (glob::debug::DRAW_UNIT_COLLECT_RANGE)
+    {
+        auto col = ToImColor(color);
+        col.Value.w = 0.2F;
+        ImPlot::GetPlotDrawList()->AddCircle(ImPlot::PlotToPixels(pos.x(), pos.y()), static_cast<float>(PlotToPixel(collectRange)), col);
+    }
+}
+
+
+void RenderState::UnitView::DrawHeadquarters(bool selected) const
+{
+    using oop::internal::gui::helper::Rotate;
+    using oop::internal::gui::helper::PlotToPixel;
+    using oop::internal::gui::helper::ToImColor;
+
+    auto drawBackgroundShape = [this](const ImColor& backgroundColor) {
+        Eigen::Vector2f TL = pos
+                             + Rotate({ -0.5F * drawSize - glob::gui::HOVER_OBJECT_SIZE_MODIFIER,
+                                        0.3F * drawSize + glob::gui::HOVER_OBJECT_SIZE_MODIFIER },
+                                      heading);
+        Eigen::Vector2f TR = pos
+                             + Rotate({ 0.5F * drawSize + glob::gui::HOVER_OBJECT_SIZE_MODIFIER,
+                                        0.3F * drawSize + glob::gui::HOVER_OBJECT_SIZE_MODIFIER },
+                                      heading);
+        Eigen::Vector2f BL = pos
+                             + Rotate({ -0.5F * drawSize - glob::gui::HOVER_OBJECT_SIZE_MODIFIER,
+                                        -0.3F * drawSize - glob::gui::HOVER_OBJECT_SIZE_MODIFIER },
+                                      heading);
+        Eigen::Vector2f BR = pos
+                             + Rotate({ 0.5F * drawSize + glob::gui::HOVER_OBJECT_SIZE_MODIFIER,
+                                        -0.3F * drawSize - glob::gui::HOVER_OBJECT_SIZE_MODIFIER },
+                                      heading);
+        ImPlot::GetPlotDrawList()->AddQuadFilled(ImPlot::PlotToPixels(TL.x(), TL.y()),
+                                                 ImPlot::PlotToPixels(TR.x(), TR.y()),
+                                                 ImPlot::PlotToPixels(BR.x(), BR.y()),
+                                                 ImPlot::PlotToPixels(BL.x(), BL.y()),
+                                                 backgroundColor);
+    };
+
+    if (selected)
+    {
+        drawBackgroundShape(ToImColor(glob::gui::COLOR_SELECTED));
+    }
+    else if (ImPlot::IsPlotHovered()
+             && (pos
+                 - Eigen::Vector2f{ ImPlot::GetPlotMousePos().x, ImPlot::GetPlotMousePos().y })
+                        .norm()
+                    <= drawSize * glob::gui::HOVER_OBJECT_SIZE_MODIFIER) // Click on unit
+    {
+        drawBackgroundShape(ToImColor(glob::gui::COLOR_HOVERED));
+    }
+
+    Eigen::Vector2f TL = pos + Rotate({ -0.5F * drawSize, 0.3F * drawSize }, heading);
+    Eigen::Vector2f TR = pos + Rotate({ 0.5F * drawSize, 0.3F * drawSize }, heading);
+    Eigen::Vector2f BL = pos + Rotate({ -0.5F * drawSize, -0.3F * drawSize }, heading);
+    Eigen::Vector2f BR = pos + Rotate({ 0.5F * drawSize, -0.3F * drawSize }, heading);
+    // ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(TL.x(), TL.y()), PlotToPixel(0.1), ImColor{ 255, 0, 0 });
+    // ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(TR.x(), TR.y()), PlotToPixel(0.1), ImColor{ 0, 255, 0 });
+    // ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(BL.x(), BL.y()), PlotToPixel(0.1), ImColor{ 0, 0, 255 });
+    // ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(BR.x(), BR.y()), PlotToPixel(0.1), ImColor{ 255, 255, 255 });
+
+    ImPlot::GetPlotDrawList()->AddQuadFilled(ImPlot::PlotToPixels(TL.x(), TL.y()),
+                                             ImPlot::PlotToPixels(TR.x(), TR.y()),
+                                             ImPlot::PlotToPixels(BR.x(), BR.y()),
+                                             ImPlot::PlotToPixels(BL.x(), BL.y()),
+                                             ToImColor(color));
+
+    if (glob::debug::DRAW_SPAWN_BOUNDARIES)
+    {
+        ImPlot::GetPlotDrawList()->AddCircle(ImPlot::PlotToPixels(pos.x(), pos.y()), static_cast<float>(PlotToPixel(glob::resources::MIN_DISTANCE_RESOURCE_TO_HQ)), ImColor{ 255, 0, 0, 120 });
+        ImPlot::GetPlotDrawList()->AddCircle(ImPlot::PlotToPixels(pos.x(), pos.y()), static_cast<float>(PlotToPixel(glob::resources::MIN_DISTANCE_RESOURCE_TO_HQ_LIMITED)), ImColor{ 255, 0, 0, 80 });
+    }
+    if (glob::debug::DRAW_HQ_HEAL_RANGE)
+    {
+        ImPlot::GetPlotDrawList()->AddCircle(ImPlot::PlotToPixels(pos.x(), pos.y()),
+                                             static_cast<float>(PlotToPixel(glob::units::ATTR_HQ_HEAL_RANGE)),
+                                             ImColor{ 0, 255, 0, 120 });
+    }
+}
+
+
+void RenderState::UnitView::DrawVirus(bool selected) const
+{
+    using internal::gui::helper::PlotToPixel;
+    using internal::gui::helper::ToImColor;
+
+    auto drawBackgroundShape = [this](const ImColor& backgroundColor) {
+        ImPlot::GetPlotDrawList()->AddCircleFilled(ImPlot::PlotToPixels(pos.x(), pos.y()),
+                                                   0.7F * static_cast<float>(PlotToPixel(drawSize)), backgroundColor);
+    };
+
+    if (selected)
+    {
+        drawBackgroundShape(ToImColor(glob::gui::COLOR_SELECTED));
+    }
+    else if (ImPlot::IsPlotHovered()
+             && (pos - Eigen::Vector2f{ ImPlot::GetPlotMousePos().x, ImPlot::GetPlotMousePos().y })
+                        .norm()
+                    <= drawSize * glob::gui::HOVER_OBJECT_SIZE_MODIFIER)
+    {
+        drawBackgroundShape(ToImColor(glob::gui::COLOR_HOVERED));
+    }
+
+    Eigen::Vector2f upperLeft = pos + Eigen::Vector2f{ -0.5F * drawSize, 0.5F * drawSize };
+    Eigen::Vector2f lowerRright = pos + Eigen::Vector2f{ 0.5F * drawSize, -0.5F * drawSize };
+    ImPlot::GetPlotDrawList()->AddImage(GameApplication::virusTexture,
+                                        ImPlot::PlotToPixels(upperLeft.x(), upperLeft.y()),
+                                        ImPlot::PlotToPixels(lowerRright.x(), lowerRright.y()));
+}
+
+} // namespace oop::internal
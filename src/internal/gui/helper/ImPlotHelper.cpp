@@ -24,4 +24,9 @@ Eigen::Vector2f gui::helper::Rotate(const Eigen::Vector2f& point, float heading)
     return Eigen::Rotation2Df{ heading } * point;
 }
 
+ImColor gui::helper::ToImColor(const Color& color)
+{
+    return ImColor{ color.r, color.g, color.b, color.a };
+}
+
 } // namespace oop::internal
\ No newline at end of file
@@ -6,6 +6,9 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <imgui.h>
+
+#include "internal/helper/Color.hpp"
 
 namespace oop::internal::gui::helper
 {
@@ -26,4 +29,9 @@ double PixelToPlot(double pixel);
 /// @return The rotated point
 Eigen::Vector2f Rotate(const Eigen::Vector2f& point, float heading);
 
+/// @brief Converts a game color into an ImGui color
+/// @param[in] color The color to convert
+/// @return The ImGui color
+ImColor ToImColor(const Color& color);
+
 } // namespace oop::internal::gui::helper
@@ -3,8 +3,10 @@
 #include <imgui.h>
 #include "internal/gui/widgets/imgui_ex.hpp"
 #include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/main/ProfilerPanel.hpp"
 
 #include "internal/GameApplication.hpp"
+#include "internal/Snapshot.hpp"
 #include "internal/game/Settings.hpp"
 #include "internal/game/GameState.hpp"
 #include "internal/helper/RandomNumberGenerator.hpp"
@@ -17,19 +19,27 @@ void ControlPanel::Draw(float panelWidth, float panelTotalWidth)
     panelTotalWidth -= 3 * ImGui::GetStyle().WindowPadding.x;
     ImGui::BeginChild("ControlPanel", ImVec2{ panelTotalWidth, ImGui::GetContentRegionAvail().y }, false);
 
+    auto& simulation = GameState::simulation;
+    const auto& state = simulation.GetRenderState();
+
     float cursorPosX = ImGui::GetCursorPosX();
-    if (GameApplication::gameFinished)
+    if (state.gameFinished)
     {
         ImGui::BeginDisabled();
     }
-    if (ImGui::Button(GameApplication::gameRunning
+    if (ImGui::Button(state.gameRunning
                           ? "Pause"
-                          : (GameApplication::gameTime == 0 ? "Start" : "Continue"),
+                          : (state.gameTime == 0 ? "Start" : "Continue"),
                       ImVec2(80.0F, 0.0F)))
     {
-        GameApplication::gameRunning = !GameApplication::gameRunning;
+        simulation.Post([](World& world) {
+            if (!world.m_gameFinished)
+            {
+                world.m_gameRunning = !world.m_gameRunning;
+            }
+        });
     }
-    if (GameApplication::gameFinished)
+    if (state.gameFinished)
     {
         ImGui::EndDisabled();
     }
@@ -37,12 +47,35 @@ void ControlPanel::Draw(float panelWidth, float panelTotalWidth)
     ImGui::SameLine();
     if (ImGui::Button("Reset", ImVec2(80.0F, 0.0F)))
     {
-        GameApplication::gameRunning = false;
-        GameApplication::gameFinished = false;
-        GameApplication::winningPlayerColor = { 0, 0, 0, 0 };
+        GameState::selectedGid = 0;
+        simulation.Post([useSeed = useSeedInsteadOfSystemTime, newSeed = seed](World& world) {
+            world.m_gameRng.useSeedInsteadOfSystemTime = useSeed;
+            world.m_gameRng.seed = newSeed;
+            world.OnStart();
+        });
+        GameApplication::EndSlowDownGame(3600.0F);
+    }
 
-        GameApplication::gameTime = 0;
-        GameState::OnStart();
+    ImGui::SameLine();
+    if (ImGui::Button("Save", ImVec2(50.0F, 0.0F)))
+    {
+        simulation.Post([](World& world) { Snapshot::Save(world, glob::gui::SNAPSHOT_PATH); });
+    }
+    if (ImGui::IsItemHovered())
+    {
+        ImGui::SetTooltip("Saves the complete match to '%s'", glob::gui::SNAPSHOT_PATH);
+    }
+
+    ImGui::SameLine();
+    if (ImGui::Button("Load", ImVec2(50.0F, 0.0F)))
+    {
+        GameState::selectedGid = 0;
+        simulation.Post([](World& world) { Snapshot::Load(world, glob::gui::SNAPSHOT_PATH); });
+        GameApplication::EndSlowDownGame(3600.0F);
+    }
+    if (ImGui::IsItemHovered())
+    {
+        ImGui::SetTooltip("Continues the match saved in '%s' (paused)", glob::gui::SNAPSHOT_PATH);
     }
 
     ImGui::SameLine();
@@ -53,15 +86,16 @@ void ControlPanel::Draw(float panelWidth, float panelTotalWidth)
     }
 
     cursorPosX = ImGui::GetCursorPosX();
-    ImGui::Checkbox("##useSeedInsteadOfSystemTime", &RandomNumberGenerator::gameRngGenerator().useSeedInsteadOfSystemTime);
+    ImGui::Checkbox("##useSeedInsteadOfSystemTime", &useSeedInsteadOfSystemTime);
     ImGui::SameLine();
-    if (!RandomNumberGenerator::gameRngGenerator().useSeedInsteadOfSystemTime)
+    if (!useSeedInsteadOfSystemTime)
     {
+        seed = state.seed; // Seed the system time gave to the current match
         ImGui::BeginDisabled();
     }
     ImGui::SetNextItemWidth(panelWidth - (ImGui::GetCursorPosX() - cursorPosX));
-    ImGui::SliderULong("Random Number Seed", &RandomNumberGenerator::gameRngGenerator().seed, 0, std::numeric_limits<uint64_t>::max() / 2, "%lu", ImGuiSliderFlags_Logarithmic | ImGuiSliderFlags_AlwaysClamp);
-    if (!RandomNumberGenerator::gameRngGenerator().useSeedInsteadOfSystemTime)
+    ImGui::SliderULong("Random Number Seed", &seed, 0, std::numeric_limits<uint64_t>::max() / 2, "%lu", ImGuiSliderFlags_Logarithmic | ImGuiSliderFlags_AlwaysClamp);
+    if (!useSeedInsteadOfSystemTime)
     {
         ImGui::EndDisabled();
     }
@@ -71,20 +105,45 @@ void ControlPanel::Draw(float panelWidth, float panelTotalWidth)
     GameState::DrawGameStats(panelTotalWidth - 2 * ImGui::GetStyle().WindowPadding.x);
 
     ImGui::SetNextItemWidth(80);
-    int32_t gameTimeLim = GameApplication::gameTimeLimit;
+    int32_t gameTimeLim = state.gameTimeLimit;
     ImGui::InputInt("Game time limit [s]", &gameTimeLim, 0, 0);
-    if (GameApplication::gameTimeLimit != gameTimeLim && !ImGui::IsItemActive())
+    if (state.gameTimeLimit != gameTimeLim && !ImGui::IsItemActive())
     {
-        GameApplication::gameTimeLimit = gameTimeLim;
+        simulation.Post([gameTimeLim](World& world) { world.m_gameTimeLimit = gameTimeLim; });
     }
 
     if (glob::debug::SHOW_DEBUG_CONFIG)
     {
         ImGui::SetNextItemWidth(80);
-        ImGui::DragFloat("Update Time step [s]", &glob::game::UPDATE_TIME_STEP, 1e-3F, 1e-3F, 1e-0F, "%.3f", ImGuiSliderFlags_AlwaysClamp);
+        if (ImGui::DragFloat("Update Time step [s]", &updateTimeStep, 1e-3F, 1e-3F, 1e-0F, "%.3f", ImGuiSliderFlags_AlwaysClamp))
+        {
+            simulation.Post([timeStep = updateTimeStep](World& /* world */) { glob::game::UPDATE_TIME_STEP = timeStep; });
+        }
         ImGui::SameLine();
         gui::widgets::HelpMarker("This greatly affects game performance, however it also controls the interval the game logic is triggered and can therefore change the outcome.");
 
+        if (ImGui::Checkbox("Phased update", &phasedUpdate))
+        {
+            simulation.Post([phased = phasedUpdate](World& /* world */) { glob::game::PHASED_UPDATE = phased; });
+        }
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(80);
+        const size_t minThinkThreads = 1;
+        const size_t maxThinkThreads = 64;
+        if (ImGui::SliderScalar("Think threads", ImGuiDataType_U64, &thinkThreads, &minThinkThreads, &maxThinkThreads, "%lu", ImGuiSliderFlags_AlwaysClamp))
+        {
+            simulation.Post([threads = thinkThreads](World& /* world */) { glob::game::THINK_THREADS = threads; });
+        }
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("All units think in parallel on the same state and their actions are applied in the order of their global ids.\nThe outcome does not depend on the amount of threads, but differs from the normal update.");
+
+        if (ImGui::Checkbox("Random streams", &randomStreams))
+        {
+            simulation.Post([streams = randomStreams](World& /* world */) { glob::game::RANDOM_STREAMS = streams; });
+        }
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("Every unit draws its random numbers from its own stream keyed by (seed, global id, tick, purpose),\nso they do not depend on the update order or on the draws of other units.");
+
         ImGui::Checkbox("Controlled camera", &GameApplication::controlledCamera);
         ImGui::SameLine();
         ImGui::SetNextItemWidth(120);
@@ -102,6 +161,11 @@ void ControlPanel::Draw(float panelWidth, float panelTotalWidth)
         ImGui::Checkbox("Draw entity positions", &glob::debug::DRAW_ENTITY_POSITIONS);
         ImGui::Checkbox("Draw satellite visibility range", &glob::debug::DRAW_SATELLITE_VISIBILITY_RANGE);
         ImGui::Checkbox("Draw satellite count on units", &glob::debug::DRAW_SATELLITE_COUNT_ON_UNITS);
+
+        if (ImGui::CollapsingHeader("Profiler"))
+        {
+            ProfilerPanel::Draw(panelTotalWidth - 2 * ImGui::GetStyle().WindowPadding.x);
+        }
     }
 
     ImGui::EndChild();
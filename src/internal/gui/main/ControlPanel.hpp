@@ -5,6 +5,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
+#include "internal/game/Settings.hpp"
+
 namespace oop::internal
 {
 class ControlPanel
@@ -17,6 +22,23 @@ class ControlPanel
     /// @param[in] panelWidth Width in pixels
     /// @param[in] panelTotalWidth Width in pixels
     static void Draw(float panelWidth, float panelTotalWidth);
+
+  private:
+    // The settings are applied by commands to the simulation thread, which is the only one reading the world and the game settings
+
+    /// @brief Flag whether the next match uses the seed instead of the system time
+    static inline bool useSeedInsteadOfSystemTime = true;
+    /// @brief Seed of the next match
+    static inline uint64_t seed = 0;
+
+    /// @brief Update time step [s]
+    static inline float updateTimeStep = glob::game::UPDATE_TIME_STEP;
+    /// @brief Flag whether the phased update is used
+    static inline bool phasedUpdate = glob::game::PHASED_UPDATE;
+    /// @brief Amount of threads for the Think phase
+    static inline size_t thinkThreads = glob::game::THINK_THREADS;
+    /// @brief Flag whether every unit draws from its own random stream
+    static inline bool randomStreams = glob::game::RANDOM_STREAMS;
 };
 
 } // namespace oop::internal
@@ -0,0 +1,129 @@
+#include "ProfilerPanel.hpp"
+
+#include <algorithm>
+#include <imgui.h>
+#include <implot.h>
+
+#include "internal/GameApplication.hpp"
+#include "internal/helper/Profiler.hpp"
+
+namespace oop::internal
+{
+
+void ProfilerPanel::RecordFrame(float frameTime, const RenderState& state)
+{
+    for (auto& [name, history] : phaseTimes)
+    {
+        history[historyOffset] = 0.0F;
+    }
+    for (auto& [name, history] : counters)
+    {
+        history[historyOffset] = 0.0F;
+    }
+
+    // The render state contains the sums since the start of the simulation thread, the frame gets the difference
+    const uint64_t ticks = state.updates - lastUpdates;
+    lastUpdates = state.updates;
+
+    frameTimes[historyOffset] = frameTime * 1e3F;
+    ticksPerFrame[historyOffset] = static_cast<float>(ticks);
+    updateTimeStep = state.timeStep;
+
+    if constexpr (Profiler::ENABLED)
+    {
+        for (const auto& total : state.profilerTotals)
+        {
+            auto& last = lastProfilerTotals[total.name];
+            const double sum = total.sum - last.sum;
+            const uint64_t samples = total.samples - last.samples;
+            last = total;
+            if (samples == 0)
+            {
+                continue;
+            }
+
+            if (total.type == Profiler::EventType_Zone)
+            {
+                if (ticks)
+                {
+                    phaseTimes[total.name][historyOffset] = static_cast<float>(sum * 1e-6 / static_cast<double>(ticks));
+                }
+            }
+            else
+            {
+                counters[total.name][historyOffset] = static_cast<float>(sum / static_cast<double>(samples));
+            }
+        }
+    }
+
+    historyOffset = (historyOffset + 1) % HISTORY_SIZE;
+    historyCount = std::min(historyCount + 1, HISTORY_SIZE);
+}
+
+void ProfilerPanel::Draw(float width)
+{
+    PlotHistories("Frame time", "[ms]", width, { { "Frame time", &frameTimes } }, 1e3F / 60.0F);
+    PlotHistories("Updates per frame", "", width, { { "Updates", &ticksPerFrame } });
+
+    if constexpr (!Profiler::ENABLED)
+    {
+        ImGui::TextDisabled("Configure with -DENABLE_PROFILER=ON for the update phases, scans and allocations.");
+        return;
+    }
+
+    std::map<std::string, const History*> phases;
+    for (const auto& [name, history] : phaseTimes)
+    {
+        phases.emplace(name, &history);
+    }
+    // An update has to finish within the game time step divided by the game speed to keep up
+    PlotHistories("Update phases", "[ms/update]", width, phases, updateTimeStep * 1e3F / GameApplication::gameTimeModifier);
+
+    std::map<std::string, const History*> scans;
+    for (const auto* name : { "Unit scan candidates", "Resource scan candidates" })
+    {
+        if (auto iter = counters.find(name); iter != counters.end())
+        {
+            scans.emplace(name, &iter->second);
+        }
+    }
+    PlotHistories("Scan candidates", "[1/update]", width, scans);
+
+    if (auto iter = counters.find("Heap allocations"); iter != counters.end())
+    {
+        PlotHistories("Heap allocations", "[1/update]", width, { { "Allocations", &iter->second } });
+    }
+}
+
+void ProfilerPanel::PlotHistories(const char* label, const char* unit, float width,
+                                  const std::map<std::string, const History*>& series, float budget)
+{
+    if (!ImPlot::BeginPlot(label, ImVec2(width, 150.0F)))
+    {
+        return;
+    }
+    ImPlot::SetupAxes("Frame", unit, ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+
+    // Oldest frame first, so that the newest frame is always on the right
+    History ordered{};
+    const size_t first = (historyOffset + HISTORY_SIZE - historyCount) % HISTORY_SIZE;
+    for (const auto& [name, history] : series)
+    {
+        for (size_t i = 0; i < historyCount; i++)
+        {
+            ordered.at(i) = history->at((first + i) % HISTORY_SIZE);
+        }
+        ImPlot::PlotLine(name.c_str(), ordered.data(), static_cast<int>(historyCount));
+    }
+
+    if (budget > 0.0F)
+    {
+        const std::array<float, 2> xs = { 0.0F, static_cast<float>(HISTORY_SIZE - 1) };
+        const std::array<float, 2> ys = { budget, budget };
+        ImPlot::PlotLine("Budget", xs.data(), ys.data(), 2);
+    }
+
+    ImPlot::EndPlot();
+}
+
+} // namespace oop::internal
@@ -0,0 +1,78 @@
+/// @file ProfilerPanel.hpp
+/// @brief Live plots of the frame time and the update phases
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "internal/game/RenderState.hpp"
+
+namespace oop::internal
+{
+
+class ProfilerPanel
+{
+  public:
+    /// @brief Default Constructor
+    ProfilerPanel() = delete;
+
+    /// @brief Adds the frame to the history together with the updates, zones and counters of the simulation thread since the last frame
+    /// @param[in] frameTime Time since the last frame in [s]
+    /// @param[in] state Render state fetched in the frame
+    static void RecordFrame(float frameTime, const RenderState& state);
+
+    /// @brief Shows the plots
+    /// @param[in] width Width in pixels
+    static void Draw(float width);
+
+  private:
+    /// Amount of frames shown in the plots
+    static constexpr size_t HISTORY_SIZE = 600;
+
+    /// Values of the last frames as ring buffer
+    using History = std::array<float, HISTORY_SIZE>;
+
+    /// Index in the ring buffers where the next frame is written
+    static inline size_t historyOffset = 0;
+
+    /// Amount of frames in the ring buffers
+    static inline size_t historyCount = 0;
+
+    /// Frame times in [ms]
+    static inline History frameTimes{};
+
+    /// Game updates per frame
+    static inline History ticksPerFrame{};
+
+    /// Time per game update in [ms] for each zone of the simulation thread
+    static inline std::map<std::string, History> phaseTimes;
+
+    /// Mean value per game update for each counter
+    static inline std::map<std::string, History> counters;
+
+    /// Amount of updates of the render state of the last frame
+    static inline uint64_t lastUpdates = 0;
+
+    /// Profiler sums of the render state of the last frame
+    static inline std::map<std::string, RenderState::ProfilerTotal> lastProfilerTotals;
+
+    /// Update time step of the simulation thread [s]
+    static inline float updateTimeStep = 0.0F;
+
+    /// @brief Plots the histories in order from the oldest to the newest frame
+    /// @param[in] label Title of the plot
+    /// @param[in] unit Label of the y axis
+    /// @param[in] width Width in pixels
+    /// @param[in] series Label and history of each line
+    /// @param[in] budget Draws a horizontal line at this value if positive
+    static void PlotHistories(const char* label, const char* unit, float width,
+                              const std::map<std::string, const History*>& series, float budget = 0.0F);
+};
+
+} // namespace oop::internal
@@ -2,7 +2,8 @@
 
 #include <imgui.h>
 #include <implot.h>
-#include "internal/GameApplication.hpp"
+#include "internal/gui/helper/ImPlotHelper.hpp"
+#include "internal/game/GameState.hpp"
 
 namespace oop::internal
 {
@@ -18,7 +19,8 @@ void GlobalWindows::RenderGlobalWindows()
         ImPlot::ShowDemoWindow();
     }
 
-    if (GameApplication::gameFinished == 2)
+    const auto& state = GameState::simulation.GetRenderState();
+    if (state.gameFinished == 2 && state.commandsApplied >= gameFinishedConfirmation)
     {
         if (!ImGui::IsPopupOpen("Game Finished"))
         {
@@ -29,11 +31,11 @@ void GlobalWindows::RenderGlobalWindows()
             ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[2]);
             ImGui::Text("The game is finished.");
 
-            if (GameApplication::winningPlayerColor.Value.w > 0)
+            if (state.winningPlayerColor.a > 0)
             {
                 ImGui::Text("Player ");
                 ImGui::SameLine();
-                ImGui::ColorButton("##player won color", GameApplication::winningPlayerColor.Value, ImGuiColorEditFlags_NoTooltip, ImVec2(30, 30));
+                ImGui::ColorButton("##player won color", gui::helper::ToImColor(state.winningPlayerColor).Value, ImGuiColorEditFlags_NoTooltip, ImVec2(30, 30));
                 ImGui::SameLine();
                 ImGui::Text("won this round!");
             }
@@ -45,7 +47,7 @@ void GlobalWindows::RenderGlobalWindows()
             ImGui::Indent(ImGui::GetContentRegionAvail().x / 2.0F - 25.0F);
             if (ImGui::Button("Ok"))
             {
-                GameApplication::gameFinished -= 1;
+                gameFinishedConfirmation = GameState::simulation.Post([](World& world) { world.m_gameFinished -= 1; });
                 ImGui::CloseCurrentPopup();
             }
             ImGui::Unindent();
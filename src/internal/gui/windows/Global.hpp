@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace oop::internal
 {
 class GlobalWindows
@@ -21,6 +23,8 @@ class GlobalWindows
     static inline bool showImGuiDemoWindow = false;
     /// @brief Flag whether the ImPlot Demo window should be displayed
     static inline bool showImPlotDemoWindow = false;
+    /// @brief Number of the command which confirmed the finished game (the popup stays closed till it is applied)
+    static inline uint64_t gameFinishedConfirmation = 0;
 
     friend class MainMenuBar;
 };
@@ -0,0 +1,48 @@
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace oop::internal
+{
+
+namespace
+{
+
+/// Amount of heap allocations of all threads
+std::atomic<uint64_t> allocationCount{ 0 };
+
+} // namespace
+
+uint64_t AllocationCounter::Count()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+} // namespace oop::internal
+
+#ifdef OOP_COUNT_ALLOCATIONS
+
+// Counts all heap allocations. The aligned and nothrow versions call these by default
+void* operator new(std::size_t size)
+{
+    oop::internal::allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /* size */) noexcept
+{
+    std::free(ptr);
+}
+
+#endif
@@ -0,0 +1,34 @@
+/// @file AllocationCounter.hpp
+/// @brief Counts the heap allocations to check that steady-state ticks do not allocate
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstdint>
+
+namespace oop::internal
+{
+
+/// @brief Counts the heap allocations of all threads by replacing the global operator new.
+///
+/// The replacement is only compiled if OOP_COUNT_ALLOCATIONS is defined (CMake option ENABLE_ALLOCATION_COUNTER, the
+/// profiler or Debug builds), as every allocation then pays an atomic increment. Otherwise the count stays 0.
+class AllocationCounter
+{
+  public:
+    /// @brief Default constructor
+    AllocationCounter() = delete;
+
+    /// @brief Flag whether the allocations get counted
+#ifdef OOP_COUNT_ALLOCATIONS
+    static constexpr bool ENABLED = true;
+#else
+    static constexpr bool ENABLED = false;
+#endif
+
+    /// @brief Amount of heap allocations of all threads since program start
+    [[nodiscard]] static uint64_t Count();
+};
+
+} // namespace oop::internal
@@ -0,0 +1,39 @@
+/// @file Color.hpp
+/// @brief Plain RGBA color, so that the game logic does not depend on ImGui
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+namespace oop
+{
+
+/// @brief RGBA color with components in [0, 1] (mirrors the ImColor constructors)
+struct Color
+{
+    float r = 0.0F; ///< Red
+    float g = 0.0F; ///< Green
+    float b = 0.0F; ///< Blue
+    float a = 1.0F; ///< Alpha
+
+    /// @brief Default constructor
+    constexpr Color() = default;
+
+    /// @brief Constructor
+    /// @param[in] red Red component [0, 255]
+    /// @param[in] green Green component [0, 255]
+    /// @param[in] blue Blue component [0, 255]
+    /// @param[in] alpha Alpha component [0, 255]
+    constexpr Color(int red, int green, int blue, int alpha = 255)
+        : r(static_cast<float>(red) / 255.0F), g(static_cast<float>(green) / 255.0F), b(static_cast<float>(blue) / 255.0F), a(static_cast<float>(alpha) / 255.0F) {}
+
+    /// @brief Constructor
+    /// @param[in] red Red component [0, 1]
+    /// @param[in] green Green component [0, 1]
+    /// @param[in] blue Blue component [0, 1]
+    /// @param[in] alpha Alpha component [0, 1]
+    constexpr Color(float red, float green, float blue, float alpha = 1.0F)
+        : r(red), g(green), b(blue), a(alpha) {}
+};
+
+} // namespace oop
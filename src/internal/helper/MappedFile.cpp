@@ -0,0 +1,86 @@
+#include "MappedFile.hpp"
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace oop::internal
+{
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path)
+{
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+    {
+        m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_mapping)
+        {
+            m_data = static_cast<const unsigned char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+            m_size = m_data ? static_cast<size_t>(fileSize.QuadPart) : 0;
+        }
+    }
+    CloseHandle(file); // The mapping keeps the file open
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mapping)
+    {
+        CloseHandle(m_mapping);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path)
+{
+    const int file = open(path.c_str(), O_RDONLY); // NOLINT(cppcoreguidelines-pro-type-vararg)
+    if (file < 0)
+    {
+        return;
+    }
+
+    struct stat fileStat = {};
+    if (fstat(file, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        void* data = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        if (data != MAP_FAILED) // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+        {
+            m_data = static_cast<const unsigned char*>(data);
+            m_size = static_cast<size_t>(fileStat.st_size);
+        }
+    }
+    close(file); // The mapping keeps the file open
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+    {
+        munmap(const_cast<unsigned char*>(m_data), m_size); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+}
+
+#endif
+
+} // namespace oop::internal
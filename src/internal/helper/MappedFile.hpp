@@ -0,0 +1,54 @@
+/// @file MappedFile.hpp
+/// @brief Read-only memory mapping of a whole file
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace oop::internal
+{
+
+/// @brief Maps a file into memory, so that its bytes can be read without copying them into a buffer first.
+///
+/// The mapping starts at a page boundary and is released by the destructor.
+class MappedFile
+{
+  public:
+    /// @brief Constructor which maps the whole file
+    /// @param[in] path Path of the file
+    explicit MappedFile(const std::string& path);
+    /// @brief Destructor which releases the mapping
+    ~MappedFile();
+    /// @brief Copy constructor
+    MappedFile(const MappedFile&) = delete;
+    /// @brief Move constructor
+    MappedFile(MappedFile&&) = delete;
+    /// @brief Copy assignment operator
+    MappedFile& operator=(const MappedFile&) = delete;
+    /// @brief Move assignment operator
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    /// @brief Checks whether the file could be mapped (empty files can not be mapped)
+    [[nodiscard]] bool IsOpen() const { return m_data != nullptr; }
+
+    /// @brief First byte of the file
+    [[nodiscard]] const unsigned char* data() const { return m_data; }
+
+    /// @brief Size of the file in bytes
+    [[nodiscard]] size_t size() const { return m_size; }
+
+  private:
+    /// Start of the mapping
+    const unsigned char* m_data = nullptr;
+    /// Size of the mapping in bytes
+    size_t m_size = 0;
+#ifdef _WIN32
+    /// Handle of the file mapping object
+    void* m_mapping = nullptr;
+#endif
+};
+
+} // namespace oop::internal
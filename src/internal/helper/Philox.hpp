@@ -0,0 +1,106 @@
+/// @file Philox.hpp
+/// @brief Counter-based Philox4x32-10 random number engine
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace oop::internal
+{
+
+/// @brief Philox4x32-10 engine (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", 2011).
+///
+/// Every block of four numbers is a pure function of the key and the counter, so streams with different keys
+/// or counters are independent and can be created anywhere without any shared state.
+/// Satisfies the UniformRandomBitGenerator requirements to be used with the standard distributions.
+class Philox4x32
+{
+  public:
+    /// Type of the generated numbers
+    using result_type = uint32_t;
+
+    /// @brief Smallest generated number
+    static constexpr result_type min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    /// @brief Largest generated number
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    /// @brief Sets the key and the counter of the stream. The first element of the counter gets incremented per block
+    /// @param[in] key Key of the stream
+    /// @param[in] counter Start value of the counter
+    void seed(const std::array<uint32_t, 2>& key, const std::array<uint32_t, 4>& counter)
+    {
+        m_key = key;
+        m_counter = counter;
+        m_index = m_block.size();
+    }
+
+    /// @brief Returns the next number of the stream
+    result_type operator()()
+    {
+        if (m_index == m_block.size())
+        {
+            m_block = Generate(m_counter, m_key);
+            if (++m_counter[0] == 0 && ++m_counter[1] == 0 && ++m_counter[2] == 0)
+            {
+                ++m_counter[3];
+            }
+            m_index = 0;
+        }
+        return m_block.at(m_index++);
+    }
+
+    /// @brief Calculates the block of the counter
+    /// @param[in] counter Counter of the block
+    /// @param[in] key Key of the stream
+    static std::array<uint32_t, 4> Generate(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key)
+    {
+        for (int round = 0; round < 10; round++)
+        {
+            if (round > 0)
+            {
+                key[0] += KEY_BUMP_0;
+                key[1] += KEY_BUMP_1;
+            }
+            const uint64_t product0 = uint64_t{ MULTIPLIER_0 } * counter[0];
+            const uint64_t product1 = uint64_t{ MULTIPLIER_1 } * counter[2];
+            counter = { static_cast<uint32_t>(product1 >> 32U) ^ counter[1] ^ key[0],
+                        static_cast<uint32_t>(product1),
+                        static_cast<uint32_t>(product0 >> 32U) ^ counter[3] ^ key[1],
+                        static_cast<uint32_t>(product0) };
+        }
+        return counter;
+    }
+
+  private:
+    /// Multiplier of the first counter pair
+    static constexpr uint32_t MULTIPLIER_0 = 0xD2511F53;
+    /// Multiplier of the second counter pair
+    static constexpr uint32_t MULTIPLIER_1 = 0xCD9E8D57;
+    /// Weyl sequence increment of the first key word (golden ratio)
+    static constexpr uint32_t KEY_BUMP_0 = 0x9E3779B9;
+    /// Weyl sequence increment of the second key word (sqrt(3) - 1)
+    static constexpr uint32_t KEY_BUMP_1 = 0xBB67AE85;
+
+    /// Key of the stream
+    std::array<uint32_t, 2> m_key{};
+    /// Counter of the next block
+    std::array<uint32_t, 4> m_counter{};
+    /// Current block of numbers
+    std::array<uint32_t, 4> m_block{};
+    /// Index of the next number in the block
+    size_t m_index = 4;
+};
+
+} // namespace oop::internal
@@ -0,0 +1,145 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <fmt/core.h>
+
+namespace oop::internal
+{
+
+namespace
+{
+
+/// Guards the list of buffers and their usage flags
+std::mutex buffersMutex;
+
+} // namespace
+
+uint64_t Profiler::Now()
+{
+    static const auto epoch = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+}
+
+void Profiler::Record(const Event& event)
+{
+    auto& buffer = LocalBuffer();
+    const uint64_t written = buffer.written.load(std::memory_order_relaxed);
+    buffer.events[written % RING_BUFFER_SIZE] = event;
+    buffer.written.store(written + 1, std::memory_order_release);
+}
+
+Profiler::ThreadBuffer& Profiler::LocalBuffer()
+{
+    /// Releases the buffer when the thread finishes
+    struct Release
+    {
+        ThreadBuffer* buffer = nullptr;
+        Release() = default;
+        ~Release()
+        {
+            if (buffer)
+            {
+                std::scoped_lock lock(buffersMutex);
+                buffer->inUse = false;
+            }
+        }
+        Release(const Release&) = delete;
+        Release(Release&&) = delete;
+        Release& operator=(const Release&) = delete;
+        Release& operator=(Release&&) = delete;
+    };
+    thread_local Release local;
+
+    if (local.buffer)
+    {
+        return *local.buffer;
+    }
+
+    std::scoped_lock lock(buffersMutex);
+    auto& buffers = Buffers();
+    auto iter = std::find_if(buffers.begin(), buffers.end(), [](const auto& buffer) { return !buffer->inUse; });
+    if (iter == buffers.end())
+    {
+        buffers.push_back(std::make_unique<ThreadBuffer>());
+        buffers.back()->threadIndex = static_cast<uint32_t>(buffers.size());
+        iter = std::prev(buffers.end());
+    }
+    (*iter)->inUse = true;
+    local.buffer = iter->get();
+    return *local.buffer;
+}
+
+std::vector<std::unique_ptr<Profiler::ThreadBuffer>>& Profiler::Buffers()
+{
+    static std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    return buffers;
+}
+
+void Profiler::ForEachNewEvent(uint64_t& cursor, const std::function<void(const Event&)>& func)
+{
+    auto& buffer = LocalBuffer();
+    const uint64_t written = buffer.written.load(std::memory_order_acquire);
+    if (cursor > written) // Buffer got cleared
+    {
+        cursor = 0;
+    }
+    for (uint64_t i = std::max(cursor, written - std::min<uint64_t>(written, RING_BUFFER_SIZE)); i < written; i++)
+    {
+        func(buffer.events[i % RING_BUFFER_SIZE]);
+    }
+    cursor = written;
+}
+
+void Profiler::Clear()
+{
+    std::scoped_lock lock(buffersMutex);
+    for (auto& buffer : Buffers())
+    {
+        buffer->written.store(0, std::memory_order_release);
+    }
+}
+
+bool Profiler::WriteChromeTrace(const std::string& path)
+{
+    std::ofstream file(path);
+    if (!file)
+    {
+        fmt::print(stderr, "Could not open the trace file '{}'\n", path);
+        return false;
+    }
+
+    std::scoped_lock lock(buffersMutex);
+
+    file << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n";
+    bool first = true;
+    for (const auto& buffer : Buffers())
+    {
+        file << fmt::format("{}{{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": {}, \"args\": {{\"name\": \"Thread {}\"}}}}",
+                            first ? "" : ",\n", buffer->threadIndex, buffer->threadIndex);
+        first = false;
+
+        const uint64_t written = buffer->written.load(std::memory_order_acquire);
+        for (uint64_t i = written - std::min<uint64_t>(written, RING_BUFFER_SIZE); i < written; i++)
+        {
+            const auto& event = buffer->events[i % RING_BUFFER_SIZE];
+            if (event.type == EventType_Zone)
+            {
+                file << fmt::format(",\n{{\"name\": \"{}\", \"ph\": \"X\", \"pid\": 1, \"tid\": {}, \"ts\": {:.3f}, \"dur\": {:.3f}}}",
+                                    event.name, buffer->threadIndex, static_cast<double>(event.start) * 1e-3, static_cast<double>(event.value) * 1e-3);
+            }
+            else
+            {
+                file << fmt::format(",\n{{\"name\": \"{}\", \"ph\": \"C\", \"pid\": 1, \"tid\": {}, \"ts\": {:.3f}, \"args\": {{\"value\": {}}}}}",
+                                    event.name, buffer->threadIndex, static_cast<double>(event.start) * 1e-3, event.value);
+            }
+        }
+    }
+    file << "\n]}\n";
+
+    return static_cast<bool>(file);
+}
+
+} // namespace oop::internal
@@ -0,0 +1,146 @@
+/// @file Profiler.hpp
+/// @brief Scoped timing zones and counters which can be written as Chrome trace
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace oop::internal
+{
+
+/// @brief Records timing zones and counters into a ring buffer per thread.
+///
+/// The recording macros OOP_PROFILE_ZONE and OOP_PROFILE_COUNTER only compile to code if OOP_PROFILER is defined
+/// (CMake option ENABLE_PROFILER). The buffers are only read while no thread records, e.g. between two updates.
+class Profiler
+{
+  public:
+    /// @brief Default constructor
+    Profiler() = delete;
+
+    /// @brief Flag whether the recording macros are compiled in
+#ifdef OOP_PROFILER
+    static constexpr bool ENABLED = true;
+#else
+    static constexpr bool ENABLED = false;
+#endif
+
+    /// @brief Amount of events kept per thread. Older ones get overwritten
+    static constexpr size_t RING_BUFFER_SIZE = 1 << 16;
+
+    /// @brief Type of a recorded event
+    enum EventType : uint8_t
+    {
+        EventType_Zone,    ///< Time span of a zone
+        EventType_Counter, ///< Value of a counter at a point in time
+    };
+
+    /// @brief Recorded event
+    struct Event
+    {
+        const char* name = nullptr;      ///< Name of the zone or counter (string literal)
+        uint64_t start = 0;              ///< Start time in [ns] since the profiler epoch
+        int64_t value = 0;               ///< Duration of the zone in [ns] or value of the counter
+        EventType type = EventType_Zone; ///< Type of the event
+    };
+
+    /// @brief Measures the time from construction till destruction
+    class Zone
+    {
+      public:
+        /// @brief Constructor
+        /// @param[in] name Name of the zone (string literal)
+        explicit Zone(const char* name)
+            : m_name(name), m_start(Now()) {}
+        /// @brief Destructor which records the zone
+        ~Zone()
+        {
+            Record({ m_name, m_start, static_cast<int64_t>(Now() - m_start), EventType_Zone });
+        }
+        /// @brief Copy constructor
+        Zone(const Zone&) = delete;
+        /// @brief Move constructor
+        Zone(Zone&&) = delete;
+        /// @brief Copy assignment operator
+        Zone& operator=(const Zone&) = delete;
+        /// @brief Move assignment operator
+        Zone& operator=(Zone&&) = delete;
+
+      private:
+        /// Name of the zone
+        const char* m_name;
+        /// Start time in [ns]
+        uint64_t m_start;
+    };
+
+    /// @brief Records the current value of a counter
+    /// @param[in] name Name of the counter (string literal)
+    /// @param[in] value Value of the counter
+    static void Counter(const char* name, int64_t value)
+    {
+        Record({ name, Now(), value, EventType_Counter });
+    }
+
+    /// @brief Writes the events of all threads as Chrome trace JSON (chrome://tracing, Perfetto)
+    /// @param[in] path Path of the file
+    /// @return True if the file could be written
+    static bool WriteChromeTrace(const std::string& path);
+
+    /// @brief Calls the function for the events the current thread recorded since the last call
+    /// @param[in, out] cursor Amount of events already read (start with 0)
+    /// @param[in] func Function called for every new event in the order of recording
+    static void ForEachNewEvent(uint64_t& cursor, const std::function<void(const Event&)>& func);
+
+    /// @brief Removes the events of all threads
+    static void Clear();
+
+    /// @brief Time in [ns] since the profiler epoch
+    static uint64_t Now();
+
+  private:
+    /// @brief Events of a single thread
+    struct ThreadBuffer
+    {
+        /// Ring buffer of the events
+        std::array<Event, RING_BUFFER_SIZE> events;
+        /// Amount of events written since the last clear (the ring buffer holds the last RING_BUFFER_SIZE)
+        std::atomic<uint64_t> written{ 0 };
+        /// Index of the thread in the trace
+        uint32_t threadIndex = 0;
+        /// Flag whether a thread writes to the buffer
+        bool inUse = false;
+    };
+
+    /// @brief Adds an event to the buffer of the current thread
+    /// @param[in] event Event to add
+    static void Record(const Event& event);
+
+    /// @brief Buffer of the current thread, which gets assigned on first use
+    static ThreadBuffer& LocalBuffer();
+
+    /// @brief Buffers of all threads which recorded events. Buffers of finished threads are reused by new threads
+    static std::vector<std::unique_ptr<ThreadBuffer>>& Buffers();
+};
+
+} // namespace oop::internal
+
+#ifdef OOP_PROFILER
+    #define OOP_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define OOP_PROFILE_CONCAT(a, b) OOP_PROFILE_CONCAT_IMPL(a, b)
+    /// @brief Records the time till the end of the current scope as zone
+    #define OOP_PROFILE_ZONE(name) const ::oop::internal::Profiler::Zone OOP_PROFILE_CONCAT(profileZone, __LINE__)(name)
+    /// @brief Records the value of a counter (the value is not evaluated if the profiler is disabled)
+    #define OOP_PROFILE_COUNTER(name, value) ::oop::internal::Profiler::Counter(name, static_cast<int64_t>(value))
+#else
+    #define OOP_PROFILE_ZONE(name)
+    #define OOP_PROFILE_COUNTER(name, value)
+#endif
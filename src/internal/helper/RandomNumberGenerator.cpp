@@ -1,5 +1,5 @@
 #include "RandomNumberGenerator.hpp"
-#include "internal/GameApplication.hpp"
+#include "internal/game/World.hpp"
 
 namespace oop::internal
 {
@@ -7,22 +7,18 @@ namespace oop::internal
 /// @brief Random number generator for game logic
 RandomNumberGenerator& RandomNumberGenerator::gameRngGenerator()
 {
-    static RandomNumberGenerator rng;
-    return rng;
+    return World::Current().m_gameRng;
 }
 
 /// @brief Random number generator for logic triggered by the user
 RandomNumberGenerator& RandomNumberGenerator::userRngGenerator()
 {
-    static RandomNumberGenerator rng;
-    static RandomNumberGenerator rngPause;
-
-    if (GameApplication::gameRunning)
-    {
-        return rng;
-    }
+    return World::Current().UserRng();
+}
 
-    return rngPause;
+RandomNumberGenerator& RandomNumberGenerator::userRngGenerator(size_t gid, RandomPurpose purpose)
+{
+    return World::Current().UserRng(gid, purpose);
 }
 
-} // namespace oop::internal
\ No newline at end of file
+} // namespace oop::internal
@@ -5,9 +5,13 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <random>
 #include <chrono>
 
+#include "Philox.hpp"
+
 namespace oop
 {
 class RandomNumber;
@@ -15,6 +19,16 @@ class RandomNumber;
 namespace internal
 {
 
+/// @brief Purposes of random numbers an entity draws. Every purpose gets its own stream with glob::game::RANDOM_STREAMS
+enum RandomPurpose : uint8_t
+{
+    RandomPurpose_Attributes,           ///< Attribute spread and heading bias when constructing a unit
+    RandomPurpose_Spawn,                ///< Position and heading when spawning a unit at the headquarters
+    RandomPurpose_SatelliteMeasurement, ///< Noise in the satellite distance measurements of a unit
+    RandomPurpose_Think,                ///< Decisions of a unit or player in its Think function
+    RandomPurpose_COUNT,                // Count variable
+};
+
 class RandomNumberGenerator // NOLINT(cert-msc32-c,cert-msc51-cpp)
 {
   public:
@@ -29,6 +43,25 @@ class RandomNumberGenerator // NOLINT(cert-msc32-c,cert-msc51-cpp)
             seed = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
         }
         random_engine.seed(seed);
+        isStream = false;
+    }
+
+    /// @brief Turns the generator into a counter-based stream which only depends on its key
+    /// @param[in] streamSeed Seed of the match
+    /// @param[in] gid Global id of the entity drawing the numbers
+    /// @param[in] tick Update the numbers are drawn in
+    /// @param[in] purpose Purpose of the numbers
+    void resetStream(uint64_t streamSeed, uint64_t gid, uint64_t tick, RandomPurpose purpose)
+    {
+        // SplitMix64 finalizer, so that neighbouring global ids get unrelated keys
+        uint64_t key = streamSeed ^ (gid * 0x9E3779B97F4A7C15ULL);
+        key = (key ^ (key >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        key = (key ^ (key >> 27U)) * 0x94D049BB133111EBULL;
+        key ^= key >> 31U;
+
+        stream_engine.seed({ static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32U) },
+                           { 0, purpose, static_cast<uint32_t>(tick), static_cast<uint32_t>(tick >> 32U) });
+        isStream = true;
     }
 
     /// @brief Gives a random number within [min, max] with normal distribution around the mean
@@ -41,7 +74,7 @@ class RandomNumberGenerator // NOLINT(cert-msc32-c,cert-msc51-cpp)
     {
         while (true)
         {
-            auto number = std::normal_distribution<T>{ mean, stddev }(random_engine);
+            auto number = draw(std::normal_distribution<T>{ mean, stddev });
             // ++cnt;
             if (number >= min && number <= max)
             {
@@ -67,7 +100,7 @@ class RandomNumberGenerator // NOLINT(cert-msc32-c,cert-msc51-cpp)
     T uniform_real_distribution(T a, T b = 1.0)
     {
         // ++cnt;
-        return std::uniform_real_distribution<T>{ a, b }(random_engine);
+        return draw(std::uniform_real_distribution<T>{ a, b });
     }
 
     /// @brief Gives a random number within [min, max] with uniform distribution
@@ -77,22 +110,47 @@ class RandomNumberGenerator // NOLINT(cert-msc32-c,cert-msc51-cpp)
     T uniform_int_distribution(T a = std::numeric_limits<T>::min(), T b = std::numeric_limits<T>::max())
     {
         // ++cnt;
-        return std::uniform_int_distribution<T>{ a, b }(random_engine);
+        return draw(std::uniform_int_distribution<T>{ a, b });
     }
 
   private:
     std::default_random_engine random_engine; ///< Random number generator
+    Philox4x32 stream_engine;                 ///< Counter-based random number generator used as stream
+    bool isStream = false;                    ///< Flag whether the numbers are drawn from the stream engine
     bool useSeedInsteadOfSystemTime = true;   ///< Flag whether to use the seed instead of the system time
     uint64_t seed = 0;                        ///< Seed for the random number generator
 
-    /// @brief Random number generator for game logic
+    /// @brief Draws a number of the distribution from the active engine
+    /// @param[in] distribution Distribution to draw from
+    template<typename Distribution>
+    auto draw(Distribution&& distribution)
+    {
+        return isStream ? distribution(stream_engine) : distribution(random_engine);
+    }
+
+    /// @brief Random number generator for game logic of the world bound to this thread
     static RandomNumberGenerator& gameRngGenerator();
 
-    /// @brief Random number generator for user triggered game logic
+    /// @brief Random number generator for user triggered game logic of the world bound to this thread
     static RandomNumberGenerator& userRngGenerator();
 
+    /// @brief Random number generator for user triggered game logic of an entity.
+    ///
+    /// With glob::game::RANDOM_STREAMS this is a stream which only depends on (seed, gid, tick, purpose) and is
+    /// independent of the update order and the thread. Every call restarts the stream, so keep the reference while
+    /// drawing several numbers. Otherwise it is the shared generator of userRngGenerator().
+    /// @param[in] gid Global id of the entity drawing the numbers
+    /// @param[in] purpose Purpose of the numbers
+    static RandomNumberGenerator& userRngGenerator(size_t gid, RandomPurpose purpose);
+
     friend class ControlPanel;
-    friend class GameState;
+    friend class HeadlessApplication;
+    friend class Tournament;
+    friend class Replay;
+    friend class Snapshot;
+    friend class Benchmarks;
+    friend struct RenderState;
+    friend class World;
     friend class PlayerBase;
     friend class NeutralPlayer;
     friend class Satellite;
@@ -0,0 +1,456 @@
+#include "ScanKernel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "internal/helper/TickArena.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    #define OOP_SCAN_KERNEL_X86
+    #include <immintrin.h>
+    // The helpers are compiled into each instruction set. Calling SSE code with dirty AVX registers would stall
+    #define OOP_SCAN_KERNEL_INLINE __attribute__((always_inline)) inline
+#else
+    #define OOP_SCAN_KERNEL_INLINE inline
+#endif
+
+namespace oop::internal
+{
+
+namespace
+{
+
+constexpr float PI = 3.14159265358979323846F;
+constexpr float PI_2 = 1.57079632679489661923F;
+constexpr float PI_4 = 0.78539816339744830962F;
+constexpr float TAN_PI_8 = 0.41421356237309504880F;
+
+// Coefficients of the arctangent polynomial on [-tan(pi/8), tan(pi/8)] (Cephes atanf)
+constexpr float ATAN_P0 = 8.05374449538e-2F;
+constexpr float ATAN_P1 = -1.38776856032e-1F;
+constexpr float ATAN_P2 = 1.99777106478e-1F;
+constexpr float ATAN_P3 = -3.33329491539e-1F;
+
+/// @brief Targets which passed the culling by their squared distance
+struct Survivors
+{
+    uint32_t* indices;      ///< Indices of the targets
+    float* bearingY;        ///< Negative x difference to the target (y argument of the bearing arctangent)
+    float* bearingX;        ///< Y difference to the target (x argument of the bearing arctangent)
+    float* squaredDistance; ///< Squared distance to the target
+};
+
+/// @brief Same operations as the vectorised arctangents for a single value
+OOP_SCAN_KERNEL_INLINE float Atan2Scalar(float y, float x)
+{
+    const float absX = std::abs(x);
+    const float absY = std::abs(y);
+    const float maxXY = std::max(absX, absY);
+    const float minXY = std::min(absX, absY);
+    const float a = maxXY > 0.0F ? minXY / maxXY : 0.0F;
+
+    // Reduces the argument to [-tan(pi/8), tan(pi/8)] with atan(a) = pi/4 + atan((a - 1) / (a + 1))
+    const bool big = a > TAN_PI_8;
+    const float t = big ? (a - 1.0F) / (a + 1.0F) : a;
+    const float offset = big ? PI_4 : 0.0F;
+    const float z = t * t;
+    float p = ATAN_P0 * z + ATAN_P1;
+    p = p * z + ATAN_P2;
+    p = p * z + ATAN_P3;
+    p = p * z * t + t;
+
+    float r = offset + p;
+    r = absY > absX ? PI_2 - r : r;
+    r = x < 0.0F ? PI - r : r;
+    return y < 0.0F ? -r : r;
+}
+
+/// @brief Upper bound of the squared distances whose rounded square root can be smaller or equal than the range
+/// @param[in] range Scan range
+OOP_SCAN_KERNEL_INLINE float SquaredRangeLimit(float range)
+{
+    return range * range * (1.0F + 4.0F * std::numeric_limits<float>::epsilon());
+}
+
+/// @brief Culls the targets [first, count) with plain C++
+/// @return Amount of survivors including the n ones already found
+OOP_SCAN_KERNEL_INLINE size_t CullScalar(float centerX, float centerY, float limit, const float* xs, const float* ys, size_t first, size_t count, const Survivors& survivors, size_t n)
+{
+    for (size_t i = first; i < count; i++)
+    {
+        const float dx = xs[i] - centerX;
+        const float dy = ys[i] - centerY;
+        const float squaredDistance = dx * dx + dy * dy;
+        if (squaredDistance <= limit)
+        {
+            survivors.indices[n] = static_cast<uint32_t>(i);
+            survivors.bearingY[n] = -dx;
+            survivors.bearingX[n] = dy;
+            survivors.squaredDistance[n] = squaredDistance;
+            n++;
+        }
+    }
+    return n;
+}
+
+/// @brief Computes the exact distances and the bearings of the survivors [first, count) with plain C++
+/// @return Amount of targets in range including the n ones already found
+OOP_SCAN_KERNEL_INLINE size_t FinishScalar(float range, const Survivors& survivors, size_t first, size_t count, uint32_t* indices, float* distances, float* headings, size_t n)
+{
+    for (size_t i = first; i < count; i++)
+    {
+        const float distance = std::sqrt(survivors.squaredDistance[i]);
+        if (distance <= range)
+        {
+            indices[n] = survivors.indices[i];
+            distances[n] = distance;
+            headings[n] = Atan2Scalar(survivors.bearingY[i], survivors.bearingX[i]);
+            n++;
+        }
+    }
+    return n;
+}
+
+#ifdef OOP_SCAN_KERNEL_X86
+
+/// @brief Appends the lanes set in the mask to the survivors
+/// @return Amount of survivors
+OOP_SCAN_KERNEL_INLINE size_t AppendSurvivors(unsigned mask, size_t first, const float* bearingY, const float* bearingX, const float* squaredDistance, const Survivors& survivors, size_t n)
+{
+    while (mask)
+    {
+        const auto lane = static_cast<size_t>(__builtin_ctz(mask));
+        survivors.indices[n] = static_cast<uint32_t>(first + lane);
+        survivors.bearingY[n] = bearingY[lane];
+        survivors.bearingX[n] = bearingX[lane];
+        survivors.squaredDistance[n] = squaredDistance[lane];
+        n++;
+        mask &= mask - 1;
+    }
+    return n;
+}
+
+/// @brief Appends the lanes set in the mask to the output
+/// @return Amount of targets in range
+OOP_SCAN_KERNEL_INLINE size_t AppendResults(unsigned mask, size_t first, const Survivors& survivors, const float* distance, const float* heading, uint32_t* indices, float* distances, float* headings, size_t n)
+{
+    while (mask)
+    {
+        const auto lane = static_cast<size_t>(__builtin_ctz(mask));
+        indices[n] = survivors.indices[first + lane];
+        distances[n] = distance[lane];
+        headings[n] = heading[lane];
+        n++;
+        mask &= mask - 1;
+    }
+    return n;
+}
+
+// ------------------------------------------------------ SSE2 ------------------------------------------------------
+
+/// @brief Selects a where the mask is set and b otherwise
+__m128 SelectSse2(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/// @brief Same operations as ScanKernel::Atan2 for 4 lanes
+__m128 Atan2Sse2(__m128 y, __m128 x)
+{
+    const __m128 signMask = _mm_set1_ps(-0.0F);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 absX = _mm_andnot_ps(signMask, x);
+    const __m128 absY = _mm_andnot_ps(signMask, y);
+    const __m128 maxXY = _mm_max_ps(absX, absY);
+    const __m128 minXY = _mm_min_ps(absX, absY);
+    const __m128 a = _mm_and_ps(_mm_cmpgt_ps(maxXY, zero), _mm_div_ps(minXY, maxXY));
+
+    const __m128 one = _mm_set1_ps(1.0F);
+    const __m128 big = _mm_cmpgt_ps(a, _mm_set1_ps(TAN_PI_8));
+    const __m128 t = SelectSse2(big, _mm_div_ps(_mm_sub_ps(a, one), _mm_add_ps(a, one)), a);
+    const __m128 offset = _mm_and_ps(big, _mm_set1_ps(PI_4));
+    const __m128 z = _mm_mul_ps(t, t);
+    __m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(ATAN_P0), z), _mm_set1_ps(ATAN_P1));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(ATAN_P2));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(ATAN_P3));
+    p = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), t), t);
+
+    __m128 r = _mm_add_ps(offset, p);
+    r = SelectSse2(_mm_cmpgt_ps(absY, absX), _mm_sub_ps(_mm_set1_ps(PI_2), r), r);
+    r = SelectSse2(_mm_cmplt_ps(x, zero), _mm_sub_ps(_mm_set1_ps(PI), r), r);
+    return _mm_xor_ps(r, _mm_and_ps(_mm_cmplt_ps(y, zero), signMask));
+}
+
+size_t CullSse2(float centerX, float centerY, float limit, const float* xs, const float* ys, size_t count, const Survivors& survivors)
+{
+    const __m128 signMask = _mm_set1_ps(-0.0F);
+    const __m128 cx = _mm_set1_ps(centerX);
+    const __m128 cy = _mm_set1_ps(centerY);
+    const __m128 lim = _mm_set1_ps(limit);
+    size_t n = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), cx);
+        const __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), cy);
+        const __m128 squaredDistance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        if (const auto mask = static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(squaredDistance, lim))))
+        {
+            alignas(16) float lanes[3][4];
+            _mm_store_ps(lanes[0], _mm_xor_ps(dx, signMask));
+            _mm_store_ps(lanes[1], dy);
+            _mm_store_ps(lanes[2], squaredDistance);
+            n = AppendSurvivors(mask, i, lanes[0], lanes[1], lanes[2], survivors, n);
+        }
+    }
+    return CullScalar(centerX, centerY, limit, xs, ys, i, count, survivors, n);
+}
+
+size_t FinishSse2(float range, const Survivors& survivors, size_t count, uint32_t* indices, float* distances, float* headings)
+{
+    const __m128 rng = _mm_set1_ps(range);
+    size_t n = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 distance = _mm_sqrt_ps(_mm_loadu_ps(survivors.squaredDistance + i));
+        if (const auto mask = static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(distance, rng))))
+        {
+            alignas(16) float lanes[2][4];
+            _mm_store_ps(lanes[0], distance);
+            _mm_store_ps(lanes[1], Atan2Sse2(_mm_loadu_ps(survivors.bearingY + i), _mm_loadu_ps(survivors.bearingX + i)));
+            n = AppendResults(mask, i, survivors, lanes[0], lanes[1], indices, distances, headings, n);
+        }
+    }
+    return FinishScalar(range, survivors, i, count, indices, distances, headings, n);
+}
+
+// ------------------------------------------------------ AVX2 ------------------------------------------------------
+
+__attribute__((target("avx2"))) __m256 Atan2Avx2(__m256 y, __m256 x)
+{
+    const __m256 signMask = _mm256_set1_ps(-0.0F);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 absX = _mm256_andnot_ps(signMask, x);
+    const __m256 absY = _mm256_andnot_ps(signMask, y);
+    const __m256 maxXY = _mm256_max_ps(absX, absY);
+    const __m256 minXY = _mm256_min_ps(absX, absY);
+    const __m256 a = _mm256_and_ps(_mm256_cmp_ps(maxXY, zero, _CMP_GT_OQ), _mm256_div_ps(minXY, maxXY));
+
+    const __m256 one = _mm256_set1_ps(1.0F);
+    const __m256 big = _mm256_cmp_ps(a, _mm256_set1_ps(TAN_PI_8), _CMP_GT_OQ);
+    const __m256 t = _mm256_blendv_ps(a, _mm256_div_ps(_mm256_sub_ps(a, one), _mm256_add_ps(a, one)), big);
+    const __m256 offset = _mm256_and_ps(big, _mm256_set1_ps(PI_4));
+    const __m256 z = _mm256_mul_ps(t, t);
+    __m256 p = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(ATAN_P0), z), _mm256_set1_ps(ATAN_P1));
+    p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(ATAN_P2));
+    p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(ATAN_P3));
+    p = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(p, z), t), t);
+
+    __m256 r = _mm256_add_ps(offset, p);
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(PI_2), r), _mm256_cmp_ps(absY, absX, _CMP_GT_OQ));
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(PI), r), _mm256_cmp_ps(x, zero, _CMP_LT_OQ));
+    return _mm256_xor_ps(r, _mm256_and_ps(_mm256_cmp_ps(y, zero, _CMP_LT_OQ), signMask));
+}
+
+__attribute__((target("avx2"))) size_t CullAvx2(float centerX, float centerY, float limit, const float* xs, const float* ys, size_t count, const Survivors& survivors)
+{
+    const __m256 signMask = _mm256_set1_ps(-0.0F);
+    const __m256 cx = _mm256_set1_ps(centerX);
+    const __m256 cy = _mm256_set1_ps(centerY);
+    const __m256 lim = _mm256_set1_ps(limit);
+    size_t n = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), cx);
+        const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), cy);
+        const __m256 squaredDistance = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        if (const auto mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(squaredDistance, lim, _CMP_LE_OQ))))
+        {
+            alignas(32) float lanes[3][8];
+            _mm256_store_ps(lanes[0], _mm256_xor_ps(dx, signMask));
+            _mm256_store_ps(lanes[1], dy);
+            _mm256_store_ps(lanes[2], squaredDistance);
+            n = AppendSurvivors(mask, i, lanes[0], lanes[1], lanes[2], survivors, n);
+        }
+    }
+    return CullScalar(centerX, centerY, limit, xs, ys, i, count, survivors, n);
+}
+
+__attribute__((target("avx2"))) size_t FinishAvx2(float range, const Survivors& survivors, size_t count, uint32_t* indices, float* distances, float* headings)
+{
+    const __m256 rng = _mm256_set1_ps(range);
+    size_t n = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 distance = _mm256_sqrt_ps(_mm256_loadu_ps(survivors.squaredDistance + i));
+        if (const auto mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(distance, rng, _CMP_LE_OQ))))
+        {
+            alignas(32) float lanes[2][8];
+            _mm256_store_ps(lanes[0], distance);
+            _mm256_store_ps(lanes[1], Atan2Avx2(_mm256_loadu_ps(survivors.bearingY + i), _mm256_loadu_ps(survivors.bearingX + i)));
+            n = AppendResults(mask, i, survivors, lanes[0], lanes[1], indices, distances, headings, n);
+        }
+    }
+    return FinishScalar(range, survivors, i, count, indices, distances, headings, n);
+}
+
+// ----------------------------------------------------- AVX-512 -----------------------------------------------------
+
+// The unmasked max, min and sqrt intrinsics trigger -Wmaybe-uninitialized in the GCC headers, the zero masked ones not
+constexpr __mmask16 ALL_LANES = 0xFFFF;
+
+__attribute__((target("avx512f"))) __m512 Atan2Avx512(__m512 y, __m512 x)
+{
+    const __m512i signMask = _mm512_set1_epi32(std::numeric_limits<int32_t>::min());
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 absX = _mm512_abs_ps(x);
+    const __m512 absY = _mm512_abs_ps(y);
+    const __m512 maxXY = _mm512_maskz_max_ps(ALL_LANES, absX, absY);
+    const __m512 minXY = _mm512_maskz_min_ps(ALL_LANES, absX, absY);
+    const __m512 a = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(maxXY, zero, _CMP_GT_OQ), _mm512_div_ps(minXY, maxXY));
+
+    const __m512 one = _mm512_set1_ps(1.0F);
+    const __mmask16 big = _mm512_cmp_ps_mask(a, _mm512_set1_ps(TAN_PI_8), _CMP_GT_OQ);
+    const __m512 t = _mm512_mask_blend_ps(big, a, _mm512_div_ps(_mm512_sub_ps(a, one), _mm512_add_ps(a, one)));
+    const __m512 offset = _mm512_maskz_mov_ps(big, _mm512_set1_ps(PI_4));
+    const __m512 z = _mm512_mul_ps(t, t);
+    __m512 p = _mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps(ATAN_P0), z), _mm512_set1_ps(ATAN_P1));
+    p = _mm512_add_ps(_mm512_mul_ps(p, z), _mm512_set1_ps(ATAN_P2));
+    p = _mm512_add_ps(_mm512_mul_ps(p, z), _mm512_set1_ps(ATAN_P3));
+    p = _mm512_add_ps(_mm512_mul_ps(_mm512_mul_ps(p, z), t), t);
+
+    __m512 r = _mm512_add_ps(offset, p);
+    r = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(absY, absX, _CMP_GT_OQ), r, _mm512_sub_ps(_mm512_set1_ps(PI_2), r));
+    r = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, zero, _CMP_LT_OQ), r, _mm512_sub_ps(_mm512_set1_ps(PI), r));
+    const __m512i negated = _mm512_xor_si512(_mm512_castps_si512(r), signMask);
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(y, zero, _CMP_LT_OQ), r, _mm512_castsi512_ps(negated));
+}
+
+__attribute__((target("avx512f"))) size_t CullAvx512(float centerX, float centerY, float limit, const float* xs, const float* ys, size_t count, const Survivors& survivors)
+{
+    const __m512i signMask = _mm512_set1_epi32(std::numeric_limits<int32_t>::min());
+    const __m512i laneIndices = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    const __m512 cx = _mm512_set1_ps(centerX);
+    const __m512 cy = _mm512_set1_ps(centerY);
+    const __m512 lim = _mm512_set1_ps(limit);
+    size_t n = 0;
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512 dx = _mm512_sub_ps(_mm512_loadu_ps(xs + i), cx);
+        const __m512 dy = _mm512_sub_ps(_mm512_loadu_ps(ys + i), cy);
+        const __m512 squaredDistance = _mm512_add_ps(_mm512_mul_ps(dx, dx), _mm512_mul_ps(dy, dy));
+        if (const __mmask16 mask = _mm512_cmp_ps_mask(squaredDistance, lim, _CMP_LE_OQ))
+        {
+            const __m512i index = _mm512_add_epi32(_mm512_set1_epi32(static_cast<int32_t>(i)), laneIndices);
+            _mm512_mask_compressstoreu_epi32(survivors.indices + n, mask, index);
+            _mm512_mask_compressstoreu_ps(survivors.bearingY + n, mask, _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(dx), signMask)));
+            _mm512_mask_compressstoreu_ps(survivors.bearingX + n, mask, dy);
+            _mm512_mask_compressstoreu_ps(survivors.squaredDistance + n, mask, squaredDistance);
+            n += static_cast<size_t>(__builtin_popcount(mask));
+        }
+    }
+    return CullScalar(centerX, centerY, limit, xs, ys, i, count, survivors, n);
+}
+
+__attribute__((target("avx512f"))) size_t FinishAvx512(float range, const Survivors& survivors, size_t count, uint32_t* indices, float* distances, float* headings)
+{
+    const __m512 rng = _mm512_set1_ps(range);
+    size_t n = 0;
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512 distance = _mm512_maskz_sqrt_ps(ALL_LANES, _mm512_loadu_ps(survivors.squaredDistance + i));
+        if (const __mmask16 mask = _mm512_cmp_ps_mask(distance, rng, _CMP_LE_OQ))
+        {
+            const __m512 heading = Atan2Avx512(_mm512_loadu_ps(survivors.bearingY + i), _mm512_loadu_ps(survivors.bearingX + i));
+            _mm512_mask_compressstoreu_epi32(indices + n, mask, _mm512_loadu_si512(survivors.indices + i));
+            _mm512_mask_compressstoreu_ps(distances + n, mask, distance);
+            _mm512_mask_compressstoreu_ps(headings + n, mask, heading);
+            n += static_cast<size_t>(__builtin_popcount(mask));
+        }
+    }
+    return FinishScalar(range, survivors, i, count, indices, distances, headings, n);
+}
+
+#endif
+
+} // namespace
+
+const char* ScanKernel::IsaName(Isa isa)
+{
+    switch (isa)
+    {
+    case Isa_Scalar:
+        return "Scalar";
+    case Isa_SSE2:
+        return "SSE2";
+    case Isa_AVX2:
+        return "AVX2";
+    case Isa_AVX512:
+        return "AVX-512";
+    case Isa_COUNT:
+        break;
+    }
+    return "Unknown";
+}
+
+ScanKernel::Isa ScanKernel::DetectedIsa()
+{
+    static const Isa detectedIsa = []() {
+#ifdef OOP_SCAN_KERNEL_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return Isa_AVX512;
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return Isa_AVX2;
+        }
+        return Isa_SSE2; // Part of every x86-64 CPU
+#else
+        return Isa_Scalar;
+#endif
+    }();
+    return detectedIsa;
+}
+
+size_t ScanKernel::Scan(float centerX, float centerY, float range, const float* xs, const float* ys, size_t count, uint32_t* indices, float* distances, float* headings, Isa isa)
+{
+    isa = std::min(isa, DetectedIsa());
+
+    auto& arena = TickArena::ForThread();
+    TickArena::Scope arenaScope(arena);
+    const Survivors survivors{ arena.Allocate<uint32_t>(count), arena.Allocate<float>(count), arena.Allocate<float>(count), arena.Allocate<float>(count) };
+
+    const float limit = SquaredRangeLimit(range);
+    switch (isa)
+    {
+#ifdef OOP_SCAN_KERNEL_X86
+    case Isa_AVX512:
+        count = CullAvx512(centerX, centerY, limit, xs, ys, count, survivors);
+        return FinishAvx512(range, survivors, count, indices, distances, headings);
+    case Isa_AVX2:
+        count = CullAvx2(centerX, centerY, limit, xs, ys, count, survivors);
+        return FinishAvx2(range, survivors, count, indices, distances, headings);
+    case Isa_SSE2:
+        count = CullSse2(centerX, centerY, limit, xs, ys, count, survivors);
+        return FinishSse2(range, survivors, count, indices, distances, headings);
+#endif
+    default:
+        count = CullScalar(centerX, centerY, limit, xs, ys, 0, count, survivors, 0);
+        return FinishScalar(range, survivors, 0, count, indices, distances, headings, 0);
+    }
+}
+
+float ScanKernel::Atan2(float y, float x)
+{
+    return Atan2Scalar(y, x);
+}
+
+} // namespace oop::internal
@@ -0,0 +1,68 @@
+/// @file ScanKernel.hpp
+/// @brief Vectorised distances and bearings of the objects a unit scans
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace oop::internal
+{
+
+/// @brief Computes which of many targets are in range of a position and their distances and bearings.
+///
+/// The targets are passed as separate x and y arrays. The kernel culls them by their distance first and computes the
+/// bearings afterwards only for the targets in range. The widest instruction set the CPU supports (SSE2, AVX2 or
+/// AVX-512) is selected at runtime. All instruction sets perform the same operations in the same order and use the same
+/// polynomial arctangent, so their results are bit identical to the scalar path. The targets which pass the culling are
+/// kept in the TickArena of the calling thread.
+class ScanKernel
+{
+  public:
+    ScanKernel() = delete;
+
+    /// Maximum difference of the bearings to std::atan2 [ulp]
+    static constexpr int32_t MAX_HEADING_ERROR_ULP = 3;
+
+    /// @brief Instruction set the kernel uses
+    enum Isa : uint8_t
+    {
+        Isa_Scalar, ///< Plain C++ (always available)
+        Isa_SSE2,   ///< 4 lanes
+        Isa_AVX2,   ///< 8 lanes
+        Isa_AVX512, ///< 16 lanes
+        Isa_COUNT,  ///< Amount of instruction sets
+    };
+
+    /// @brief Name of the instruction set
+    /// @param[in] isa Instruction set
+    [[nodiscard]] static const char* IsaName(Isa isa);
+
+    /// @brief Widest instruction set the CPU supports (detected on the first call)
+    [[nodiscard]] static Isa DetectedIsa();
+
+    /// @brief Keeps the targets in range of the center and computes their distances and bearings
+    /// @param[in] centerX X coordinate of the scanning position
+    /// @param[in] centerY Y coordinate of the scanning position
+    /// @param[in] range Maximum distance of the targets kept (inclusive)
+    /// @param[in] xs X coordinates of the targets
+    /// @param[in] ys Y coordinates of the targets
+    /// @param[in] count Amount of targets
+    /// @param[out] indices Indices of the targets in range in ascending order (space for count entries)
+    /// @param[out] distances Distances to the targets in range (space for count entries)
+    /// @param[out] headings Bearings to the targets in range [rad], counted from the y axis in mathematical positive
+    ///                      direction like the heading of a unit (space for count entries)
+    /// @param[in] isa Instruction set to use (falls back to the detected one if the CPU does not support it)
+    /// @return Amount of targets in range
+    static size_t Scan(float centerX, float centerY, float range, const float* xs, const float* ys, size_t count, uint32_t* indices, float* distances, float* headings, Isa isa = DetectedIsa());
+
+    /// @brief Arctangent of y/x in the range [-pi, pi] with the polynomial approximation the vectorised paths use
+    /// @param[in] y Y coordinate
+    /// @param[in] x X coordinate
+    /// @return Angle [rad] with an error of at most MAX_HEADING_ERROR_ULP compared to std::atan2
+    [[nodiscard]] static float Atan2(float y, float x);
+};
+
+} // namespace oop::internal
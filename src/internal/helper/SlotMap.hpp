@@ -0,0 +1,222 @@
+/// @file SlotMap.hpp
+/// @brief Dense container with generational handles which stay valid while other values get removed
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace oop::internal
+{
+
+/// @brief Stores the values contiguously and removes them in O(1) by moving the last value into the gap.
+///
+/// Removing a value changes the order of the remaining ones, so iterate only where the order does not matter or sort
+/// by a stable key (e.g. the global id). Handles refer to a slot which remembers the current position of the value.
+/// Every removal increments the generation of the slot, so old handles resolve to nullptr instead of another value.
+/// @tparam T Type of the stored values
+template<typename T>
+class SlotMap
+{
+  public:
+    /// @brief Reference to a value which resolves to nullptr after the value got removed
+    struct Handle
+    {
+        /// Index of the slot
+        uint32_t slot = std::numeric_limits<uint32_t>::max();
+        /// Generation of the slot when the handle was created
+        uint32_t generation = 0;
+
+        /// @brief Equal comparison operator
+        bool operator==(const Handle& rhs) const { return slot == rhs.slot && generation == rhs.generation; }
+        /// @brief Not equal comparison operator
+        bool operator!=(const Handle& rhs) const { return !(*this == rhs); }
+    };
+
+    using iterator = typename std::vector<T>::iterator;             ///< Iterator over the values
+    using const_iterator = typename std::vector<T>::const_iterator; ///< Const iterator over the values
+
+    /// @brief Constructs a value at the end
+    /// @param[in] args Arguments for the constructor of the value
+    /// @return Handle of the new value
+    template<typename... Args>
+    Handle Emplace(Args&&... args)
+    {
+        uint32_t slot = m_freeSlot;
+        if (slot == NO_SLOT)
+        {
+            slot = static_cast<uint32_t>(m_slots.size());
+            m_slots.push_back({});
+        }
+        else
+        {
+            m_freeSlot = m_slots[slot].index;
+        }
+
+        m_values.emplace_back(std::forward<Args>(args)...);
+        m_valueSlots.push_back(slot);
+        m_slots[slot].index = static_cast<uint32_t>(m_values.size() - 1);
+        return { slot, m_slots[slot].generation };
+    }
+
+    /// @brief Removes the value by moving the last value into its place
+    /// @param[in] position Value to remove
+    /// @return Iterator to the value which took its place (or end())
+    iterator Erase(const_iterator position)
+    {
+        const auto index = static_cast<size_t>(position - m_values.cbegin());
+        const uint32_t slot = m_valueSlots[index];
+
+        if (index + 1 != m_values.size())
+        {
+            m_values[index] = std::move(m_values.back());
+            m_valueSlots[index] = m_valueSlots.back();
+            m_slots[m_valueSlots[index]].index = static_cast<uint32_t>(index);
+        }
+        m_values.pop_back();
+        m_valueSlots.pop_back();
+
+        m_slots[slot].generation++;
+        m_slots[slot].index = m_freeSlot;
+        m_freeSlot = slot;
+
+        return m_values.begin() + static_cast<std::ptrdiff_t>(index);
+    }
+
+    /// @brief Removes the value the handle refers to
+    /// @param[in] handle Handle of the value
+    /// @return True if the value existed
+    bool Erase(const Handle& handle)
+    {
+        const T* value = Get(handle);
+        if (!value)
+        {
+            return false;
+        }
+        Erase(m_values.cbegin() + (value - m_values.data()));
+        return true;
+    }
+
+    /// @brief Removes all values for which the predicate returns true
+    /// @param[in] predicate Function taking a value
+    /// @return Amount of removed values
+    template<typename Predicate>
+    size_t EraseIf(Predicate predicate)
+    {
+        size_t removed = 0;
+        for (auto iter = m_values.begin(); iter != m_values.end();)
+        {
+            if (predicate(std::as_const(*iter)))
+            {
+                iter = Erase(iter);
+                removed++;
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+        return removed;
+    }
+
+    /// @brief Removes all values. The handles of them resolve to nullptr afterwards
+    void clear()
+    {
+        for (auto slot : m_valueSlots)
+        {
+            m_slots[slot].generation++;
+            m_slots[slot].index = m_freeSlot;
+            m_freeSlot = slot;
+        }
+        m_values.clear();
+        m_valueSlots.clear();
+    }
+
+    /// @brief Value the handle refers to
+    /// @param[in] handle Handle of the value
+    /// @return Pointer to the value or nullptr if it got removed. Invalidated by adding or removing values
+    [[nodiscard]] T* Get(const Handle& handle)
+    {
+        return const_cast<T*>(std::as_const(*this).Get(handle)); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+
+    /// @brief Value the handle refers to
+    /// @param[in] handle Handle of the value
+    /// @return Pointer to the value or nullptr if it got removed. Invalidated by adding or removing values
+    [[nodiscard]] const T* Get(const Handle& handle) const
+    {
+        if (handle.slot >= m_slots.size() || m_slots[handle.slot].generation != handle.generation)
+        {
+            return nullptr;
+        }
+        return &m_values[m_slots[handle.slot].index];
+    }
+
+    /// @brief Handle of the value at the position
+    /// @param[in] index Position in the iteration order
+    [[nodiscard]] Handle HandleAt(size_t index) const
+    {
+        const uint32_t slot = m_valueSlots.at(index);
+        return { slot, m_slots[slot].generation };
+    }
+
+    /// @brief Reserves memory for the amount of values
+    void reserve(size_t size)
+    {
+        m_values.reserve(size);
+        m_valueSlots.reserve(size);
+        m_slots.reserve(size);
+    }
+
+    /// @brief Amount of values
+    [[nodiscard]] size_t size() const { return m_values.size(); }
+    /// @brief Checks whether there are no values
+    [[nodiscard]] bool empty() const { return m_values.empty(); }
+
+    /// @brief Value at the position (with bounds checking)
+    [[nodiscard]] T& at(size_t index) { return m_values.at(index); }
+    /// @brief Value at the position (with bounds checking)
+    [[nodiscard]] const T& at(size_t index) const { return m_values.at(index); }
+    /// @brief Last value
+    [[nodiscard]] T& back() { return m_values.back(); }
+    /// @brief Last value
+    [[nodiscard]] const T& back() const { return m_values.back(); }
+
+    /// @brief Iterator to the first value
+    iterator begin() { return m_values.begin(); }
+    /// @brief Iterator behind the last value
+    iterator end() { return m_values.end(); }
+    /// @brief Iterator to the first value
+    [[nodiscard]] const_iterator begin() const { return m_values.begin(); }
+    /// @brief Iterator behind the last value
+    [[nodiscard]] const_iterator end() const { return m_values.end(); }
+
+  private:
+    /// Marks the end of the free list
+    static constexpr uint32_t NO_SLOT = std::numeric_limits<uint32_t>::max();
+
+    /// @brief Indirection from a handle to the value
+    struct Slot
+    {
+        /// Position of the value if in use, otherwise the next free slot
+        uint32_t index = NO_SLOT;
+        /// Incremented whenever the value of the slot gets removed
+        uint32_t generation = 0;
+    };
+
+    /// Values without gaps
+    std::vector<T> m_values;
+    /// Slot of every value (same order as m_values)
+    std::vector<uint32_t> m_valueSlots;
+    /// Slots referenced by the handles
+    std::vector<Slot> m_slots;
+    /// First slot of the free list
+    uint32_t m_freeSlot = NO_SLOT;
+};
+
+} // namespace oop::internal
@@ -0,0 +1,183 @@
+/// @file SpatialGrid.hpp
+/// @brief Uniform grid over the game board to speed up radius queries
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace oop::internal
+{
+
+/// @brief Uniform grid which buckets values by their position.
+///
+/// The values of all cells are stored in one array which is sorted by the cells with a counting sort, so a grid which is
+/// cleared and filled again every update does not allocate once its arrays are big enough. Values inserted after the
+/// last sort are kept in a short unsorted tail which the queries check completely. The order of the values passed to a
+/// query is therefore unspecified. Positions outside the covered area are clamped into the border cells, so queries stay
+/// correct for every position. Clearing keeps the allocated memory.
+/// @tparam T Type of the stored values (should be cheap to copy)
+template<typename T>
+class SpatialGrid
+{
+  public:
+    /// @brief Distance to add to query radii when the exact distance is checked again afterwards (rounding errors)
+    static constexpr float TOLERANCE = 1e-3F;
+
+    /// @brief Removes all values and sets the layout of the grid
+    /// @param[in] width Range of the covered area in x direction
+    /// @param[in] height Range of the covered area in y direction
+    /// @param[in] cellSize Edge length of a cell. Should be in the order of the query radius
+    void Clear(const std::array<double, 2>& width, const std::array<double, 2>& height, float cellSize)
+    {
+        m_origin = { static_cast<float>(width.at(0)), static_cast<float>(height.at(0)) };
+        m_invCellSize = 1.0F / std::max(cellSize, 1e-3F);
+        m_cellsX = static_cast<int>(std::ceil(static_cast<float>(width.at(1) - width.at(0)) * m_invCellSize)) + 1;
+        m_cellsY = static_cast<int>(std::ceil(static_cast<float>(height.at(1) - height.at(0)) * m_invCellSize)) + 1;
+
+        m_entries.clear();
+        m_sortedCount = 0;
+        m_cellStart.assign(static_cast<size_t>(m_cellsX * m_cellsY) + 1, 0);
+    }
+
+    /// @brief Adds a value to the grid. It is appended to the unsorted tail, which gets sorted when it is full
+    /// @param[in] position Position of the value
+    /// @param[in] value Value to store
+    void Insert(const Eigen::Vector2f& position, const T& value)
+    {
+        m_entries.push_back({ position, value, static_cast<uint32_t>(CellIndex(CellX(position.x()), CellY(position.y()))) });
+        if (m_entries.size() - m_sortedCount >= MAX_UNSORTED)
+        {
+            Sort();
+        }
+    }
+
+    /// @brief Sorts the unsorted tail into the cells. Should be called after inserting many values at once
+    void Sort()
+    {
+        if (m_sortedCount == m_entries.size())
+        {
+            return;
+        }
+
+        std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+        for (const auto& entry : m_entries)
+        {
+            m_cellStart[entry.cell + 1]++;
+        }
+        for (size_t c = 1; c < m_cellStart.size(); c++)
+        {
+            m_cellStart[c] += m_cellStart[c - 1];
+        }
+        m_cellCursor.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+        m_sortBuffer.resize(m_entries.size());
+        for (const auto& entry : m_entries)
+        {
+            m_sortBuffer[m_cellCursor[entry.cell]++] = entry;
+        }
+        std::swap(m_entries, m_sortBuffer);
+        m_sortedCount = m_entries.size();
+    }
+
+    /// @brief Calls the function for every value which was inserted within the radius around the center
+    /// @param[in] center Center of the query
+    /// @param[in] radius Radius of the query (inclusive)
+    /// @param[in] func Function with signature void(const Eigen::Vector2f& position, const T& value)
+    template<typename Func>
+    void ForEachInRadius(const Eigen::Vector2f& center, float radius, Func&& func) const
+    {
+        if (m_entries.empty())
+        {
+            return;
+        }
+
+        const int xMin = CellX(center.x() - radius);
+        const int xMax = CellX(center.x() + radius);
+        const int yMin = CellY(center.y() - radius);
+        const int yMax = CellY(center.y() + radius);
+        const float radiusSquared = radius * radius;
+        auto visit = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+            {
+                const auto& entry = m_entries[i];
+                if ((entry.position - center).squaredNorm() <= radiusSquared)
+                {
+                    func(entry.position, entry.value);
+                }
+            }
+        };
+
+        for (int y = yMin; y <= yMax; y++)
+        {
+            const size_t rowBegin = CellIndex(xMin, y);
+            const size_t rowEnd = CellIndex(xMax, y) + 1;
+            visit(m_cellStart[rowBegin], m_cellStart[rowEnd]); // The cells of a row are contiguous
+        }
+        visit(m_sortedCount, m_entries.size());
+    }
+
+    /// @brief Amount of values in the grid
+    [[nodiscard]] size_t Size() const
+    {
+        return m_entries.size();
+    }
+
+  private:
+    /// Amount of unsorted values after which the grid gets sorted
+    static constexpr size_t MAX_UNSORTED = 64;
+
+    /// @brief Value with its position
+    struct Entry
+    {
+        Eigen::Vector2f position; ///< Position the value was inserted with
+        T value{};                ///< Stored value
+        uint32_t cell = 0;        ///< Flat index of the cell containing the position
+    };
+
+    /// @brief Column of the cell containing the x coordinate
+    [[nodiscard]] int CellX(float x) const
+    {
+        return std::clamp(static_cast<int>(std::floor((x - m_origin.x()) * m_invCellSize)), 0, m_cellsX - 1);
+    }
+
+    /// @brief Row of the cell containing the y coordinate
+    [[nodiscard]] int CellY(float y) const
+    {
+        return std::clamp(static_cast<int>(std::floor((y - m_origin.y()) * m_invCellSize)), 0, m_cellsY - 1);
+    }
+
+    /// @brief Flat index of the cell
+    [[nodiscard]] size_t CellIndex(int x, int y) const
+    {
+        return static_cast<size_t>(y) * static_cast<size_t>(m_cellsX) + static_cast<size_t>(x);
+    }
+
+    /// Lower left corner of the covered area
+    Eigen::Vector2f m_origin{ 0.0F, 0.0F };
+    /// Inverse of the cell edge length
+    float m_invCellSize = 1.0F;
+    /// Amount of cells in x direction
+    int m_cellsX = 1;
+    /// Amount of cells in y direction
+    int m_cellsY = 1;
+
+    /// Values sorted by their cell, followed by the unsorted tail
+    std::vector<Entry> m_entries;
+    /// Amount of sorted values at the front of m_entries
+    size_t m_sortedCount = 0;
+    /// Index of the first sorted value of every cell (row-major) and the end of the sorted values as last element
+    std::vector<size_t> m_cellStart;
+    /// Write position of every cell while sorting
+    std::vector<size_t> m_cellCursor;
+    /// Target of the counting sort (swapped with m_entries afterwards)
+    std::vector<Entry> m_sortBuffer;
+};
+
+} // namespace oop::internal
@@ -0,0 +1,119 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace oop::internal
+{
+
+ThreadPool::ThreadPool(size_t threadCount)
+{
+    threadCount = std::max(threadCount, size_t{ 1 });
+    m_workers.reserve(threadCount - 1);
+    for (size_t chunk = 1; chunk < threadCount; chunk++)
+    {
+        m_workers.emplace_back([this, chunk]() { WorkerLoop(chunk); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::scoped_lock lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeUp.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::ThreadCount() const
+{
+    return m_workers.size() + 1;
+}
+
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t, size_t)>& func)
+{
+    if (m_workers.empty() || count < 2)
+    {
+        func(0, count);
+        return;
+    }
+
+    {
+        std::scoped_lock lock(m_mutex);
+        m_func = &func;
+        m_count = count;
+        m_pending = m_workers.size();
+        m_exception = nullptr;
+        m_generation++;
+    }
+    m_wakeUp.notify_all();
+
+    RunChunk(0);
+
+    std::unique_lock lock(m_mutex);
+    m_done.wait(lock, [this]() { return m_pending == 0; });
+    m_func = nullptr;
+    if (m_exception)
+    {
+        std::rethrow_exception(std::exchange(m_exception, nullptr));
+    }
+}
+
+void ThreadPool::WorkerLoop(size_t chunk)
+{
+    uint64_t generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_wakeUp.wait(lock, [this, generation]() { return m_stop || m_generation != generation; });
+            if (m_stop)
+            {
+                return;
+            }
+            generation = m_generation;
+        }
+
+        RunChunk(chunk);
+
+        bool lastWorker = false;
+        {
+            std::scoped_lock lock(m_mutex);
+            lastWorker = --m_pending == 0;
+        }
+        if (lastWorker)
+        {
+            m_done.notify_one();
+        }
+    }
+}
+
+void ThreadPool::RunChunk(size_t chunk)
+{
+    const size_t threadCount = ThreadCount();
+    const size_t begin = m_count * chunk / threadCount;
+    const size_t end = m_count * (chunk + 1) / threadCount;
+    if (begin == end)
+    {
+        return;
+    }
+
+    try
+    {
+        (*m_func)(begin, end);
+    }
+    catch (...)
+    {
+        std::scoped_lock lock(m_mutex);
+        if (!m_exception)
+        {
+            m_exception = std::current_exception();
+        }
+    }
+}
+
+} // namespace oop::internal
@@ -0,0 +1,82 @@
+/// @file ThreadPool.hpp
+/// @brief Persistent worker threads to split loops over many threads
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace oop::internal
+{
+
+/// @brief Pool of worker threads which split a loop into contiguous chunks.
+///
+/// The calling thread processes the first chunk itself, so a pool with a single thread does not start any workers.
+/// The threads wait on a condition variable between loops and are joined in the destructor.
+class ThreadPool
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] threadCount Amount of threads processing a loop including the calling thread
+    explicit ThreadPool(size_t threadCount);
+    /// @brief Destructor
+    ~ThreadPool();
+    /// @brief Copy constructor
+    ThreadPool(const ThreadPool&) = delete;
+    /// @brief Move constructor
+    ThreadPool(ThreadPool&&) = delete;
+    /// @brief Copy assignment operator
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    /// @brief Move assignment operator
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /// @brief Amount of threads processing a loop including the calling thread
+    [[nodiscard]] size_t ThreadCount() const;
+
+    /// @brief Calls the function for contiguous chunks of [0, count) on all threads and waits till all are done.
+    ///        Exceptions of the function are rethrown on the calling thread.
+    /// @param[in] count Amount of loop iterations
+    /// @param[in] func Function with signature void(size_t begin, size_t end)
+    void ParallelFor(size_t count, const std::function<void(size_t, size_t)>& func);
+
+  private:
+    /// @brief Loop of the worker threads
+    /// @param[in] chunk Chunk of the loops the worker processes
+    void WorkerLoop(size_t chunk);
+
+    /// @brief Processes a single chunk of the current loop and stores the exception if one occurs
+    /// @param[in] chunk Index of the chunk
+    void RunChunk(size_t chunk);
+
+    /// Worker threads (one less than the thread count)
+    std::vector<std::thread> m_workers;
+    /// Mutex guarding the loop state
+    std::mutex m_mutex;
+    /// Wakes up the workers for a new loop or to stop
+    std::condition_variable m_wakeUp;
+    /// Signals the calling thread that all workers finished their chunks
+    std::condition_variable m_done;
+
+    /// Function of the current loop
+    const std::function<void(size_t, size_t)>* m_func = nullptr;
+    /// Amount of iterations of the current loop
+    size_t m_count = 0;
+    /// Incremented for every loop, so that the workers notice a new loop
+    uint64_t m_generation = 0;
+    /// Amount of workers which did not finish the current loop yet
+    size_t m_pending = 0;
+    /// First exception thrown in the current loop
+    std::exception_ptr m_exception;
+    /// Flag to stop the workers
+    bool m_stop = false;
+};
+
+} // namespace oop::internal
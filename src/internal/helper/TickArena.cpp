@@ -0,0 +1,86 @@
+#include "TickArena.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace oop::internal
+{
+
+TickArena::Scope::Scope(TickArena& arena)
+    : m_arena(arena), m_block(arena.m_block), m_offset(arena.m_offset)
+{
+    m_arena.m_openScopes++;
+}
+
+TickArena::Scope::~Scope()
+{
+    m_arena.m_block = m_block;
+    m_arena.m_offset = m_offset;
+    m_arena.m_openScopes--;
+}
+
+TickArena& TickArena::ForThread()
+{
+    thread_local TickArena arena;
+    return arena;
+}
+
+void TickArena::Reset()
+{
+    assert(m_openScopes == 0 && "Resetting the arena while a scope is open");
+
+    if (m_blocks.size() > 1)
+    {
+        const size_t capacity = Capacity();
+        m_blocks.clear();
+        m_blocks.push_back({ std::make_unique<std::byte[]>(capacity), capacity });
+    }
+    m_block = 0;
+    m_offset = 0;
+}
+
+size_t TickArena::Capacity() const
+{
+    size_t capacity = 0;
+    for (const auto& block : m_blocks)
+    {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+void* TickArena::AllocateBytes(size_t size, size_t alignment)
+{
+    auto alignedOffset = [alignment](const Block& block, size_t offset) {
+        const auto address = reinterpret_cast<uintptr_t>(block.data.get()) + offset;
+        return offset + (alignment - address % alignment) % alignment;
+    };
+
+    if (m_block < m_blocks.size())
+    {
+        if (const size_t offset = alignedOffset(m_blocks[m_block], m_offset); offset + size <= m_blocks[m_block].size)
+        {
+            m_offset = offset + size;
+            return m_blocks[m_block].data.get() + offset;
+        }
+        m_block++;
+    }
+
+    // Blocks after the current one are unused, so a block too small for the request gets replaced by a bigger one
+    if (m_block < m_blocks.size() && alignedOffset(m_blocks[m_block], 0) + size > m_blocks[m_block].size)
+    {
+        m_blocks.erase(m_blocks.begin() + static_cast<std::ptrdiff_t>(m_block), m_blocks.end());
+    }
+    if (m_block == m_blocks.size())
+    {
+        const size_t blockSize = std::max({ INITIAL_BLOCK_SIZE, Capacity(), size + alignment });
+        m_blocks.push_back({ std::make_unique<std::byte[]>(blockSize), blockSize });
+    }
+
+    const size_t offset = alignedOffset(m_blocks[m_block], 0);
+    m_offset = offset + size;
+    return m_blocks[m_block].data.get() + offset;
+}
+
+} // namespace oop::internal
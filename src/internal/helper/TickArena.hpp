@@ -0,0 +1,100 @@
+/// @file TickArena.hpp
+/// @brief Bump allocator for the scratch data of a tick
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace oop::internal
+{
+
+/// @brief Bump allocator for scratch arrays which are only needed during a tick. Every thread has its own arena.
+///
+/// Allocating only advances an offset in the current block. A Scope rewinds the arena to where it was when the scope
+/// was opened, so that consecutive scans of a thread reuse the same memory. If a block is full, a bigger one is added.
+/// Reset at the end of the update merges the blocks into one block of the total size, so the arena stops allocating
+/// from the heap once it is big enough for the largest tick.
+class TickArena
+{
+  public:
+    /// @brief Rewinds the arena to its position at construction when it goes out of scope
+    class Scope
+    {
+      public:
+        /// @brief Constructor
+        /// @param[in] arena Arena to rewind
+        explicit Scope(TickArena& arena);
+        /// @brief Destructor
+        ~Scope();
+        /// @brief Copy constructor
+        Scope(const Scope&) = delete;
+        /// @brief Move constructor
+        Scope(Scope&&) = delete;
+        /// @brief Copy assignment operator
+        Scope& operator=(const Scope&) = delete;
+        /// @brief Move assignment operator
+        Scope& operator=(Scope&&) = delete;
+
+      private:
+        /// Arena to rewind
+        TickArena& m_arena;
+        /// Index of the block in use at construction
+        size_t m_block;
+        /// Offset into the block in use at construction
+        size_t m_offset;
+    };
+
+    /// @brief Default constructor
+    TickArena() = default;
+
+    /// @brief Arena of the calling thread
+    [[nodiscard]] static TickArena& ForThread();
+
+    /// @brief Allocates an uninitialized array which stays valid till the enclosing scope closes or the arena is reset
+    /// @param[in] count Amount of elements
+    template<typename T>
+    [[nodiscard]] T* Allocate(size_t count)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "The arena does not call destructors");
+        return static_cast<T*>(AllocateBytes(count * sizeof(T), alignof(T)));
+    }
+
+    /// @brief Releases all allocations and merges the blocks, so that the next tick fits into a single block.
+    ///        No scope must be open.
+    void Reset();
+
+    /// @brief Total size of the blocks in [bytes]
+    [[nodiscard]] size_t Capacity() const;
+
+  private:
+    /// Size of the first block in [bytes]
+    static constexpr size_t INITIAL_BLOCK_SIZE = size_t{ 64 } * 1024;
+
+    /// @brief Memory block of the arena
+    struct Block
+    {
+        std::unique_ptr<std::byte[]> data; ///< Memory of the block
+        size_t size = 0;                   ///< Size of the block in [bytes]
+    };
+
+    /// @brief Allocates memory from the current block or adds a new block
+    /// @param[in] size Size in [bytes]
+    /// @param[in] alignment Alignment of the memory
+    void* AllocateBytes(size_t size, size_t alignment);
+
+    /// Blocks of the arena. The blocks after the current one are empty and get reused
+    std::vector<Block> m_blocks;
+    /// Index of the block allocations are taken from
+    size_t m_block = 0;
+    /// Used bytes of the current block
+    size_t m_offset = 0;
+    /// Amount of open scopes
+    size_t m_openScopes = 0;
+};
+
+} // namespace oop::internal
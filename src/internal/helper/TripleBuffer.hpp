@@ -0,0 +1,70 @@
+/// @file TripleBuffer.hpp
+/// @brief Lock-free exchange of the newest value between a single writer and a single reader thread
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2026-10-17
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace oop::internal
+{
+
+/// @brief Three buffers of which the writer owns one, the reader owns one and the third one holds the last published value.
+///
+/// Publishing and fetching swap the own buffer with the middle one by a single atomic exchange, so neither thread ever
+/// waits for the other. The reader always gets the newest published value, values published in between are dropped.
+/// The buffers are reused, so values with containers keep their capacity over the exchanges.
+/// @tparam T Type of the values
+template<typename T>
+class TripleBuffer
+{
+  public:
+    /// @brief Buffer the writer fills before publishing it (only the writer thread may access it)
+    T& WriteBuffer() { return m_buffers.at(m_writeIndex); }
+
+    /// @brief Makes the write buffer the newest value and continues with the middle buffer (writer thread)
+    void Publish()
+    {
+        const uint8_t previous = m_middle.exchange(static_cast<uint8_t>(m_writeIndex | NEW_VALUE), std::memory_order_acq_rel);
+        m_writeIndex = previous & INDEX_MASK;
+    }
+
+    /// @brief Flag whether the last published value was not fetched by the reader yet
+    [[nodiscard]] bool HasUnfetched() const { return m_middle.load(std::memory_order_acquire) & NEW_VALUE; }
+
+    /// @brief Makes the newest published value the read buffer if there is one (reader thread)
+    /// @return True if the read buffer changed
+    bool Fetch()
+    {
+        if (!HasUnfetched())
+        {
+            return false;
+        }
+        const uint8_t previous = m_middle.exchange(m_readIndex, std::memory_order_acq_rel);
+        m_readIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    /// @brief Last value fetched by the reader (only the reader thread may access it)
+    [[nodiscard]] const T& ReadBuffer() const { return m_buffers.at(m_readIndex); }
+
+  private:
+    /// Bit of the middle index which marks a value that was published but not fetched yet
+    static constexpr uint8_t NEW_VALUE = 0x4;
+    /// Bits of the middle index which hold the buffer index
+    static constexpr uint8_t INDEX_MASK = 0x3;
+
+    /// The buffers
+    std::array<T, 3> m_buffers{};
+    /// Index of the buffer the writer fills
+    uint8_t m_writeIndex = 0;
+    /// Index of the buffer the reader uses
+    uint8_t m_readIndex = 1;
+    /// Index of the middle buffer together with the NEW_VALUE flag
+    std::atomic<uint8_t> m_middle{ 2 };
+};
+
+} // namespace oop::internal
@@ -0,0 +1,198 @@
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <fmt/core.h>
+
+#include "spdlog/spdlog.h"
+#include "spdlog/sinks/stdout_color_sinks.h"
+
+#include "internal/HeadlessApplication.hpp"
+#include "internal/game/Settings.hpp"
+#include "internal/Tournament.hpp"
+#include "internal/Replay.hpp"
+#include "internal/helper/Profiler.hpp"
+
+namespace
+{
+
+void PrintUsage(const char* executable)
+{
+    fmt::print("Usage: {} [--seed <seed>] [--seeds <count>] [--threads <count>] [--csv <file>] [--json <file>]\n"
+               "       [--ticks <count>] [--dt <seconds>] [--phased] [--think-threads <count>] [--random-streams] [--trace <file>]\n"
+               "       [--record <file>] [--replay <file>] [--snapshot <file>] [--restore <file>] [--verbose]\n"
+               "  --seed     Seed for the game random number generator (default: 0)\n"
+               "  --seeds    Amount of matches to play with consecutive seeds starting at --seed (default: 1)\n"
+               "  --threads  Amount of threads playing the matches in parallel (default: all hardware threads)\n"
+               "  --csv      Write the results of every match to the file and the aggregated ones to <file>_aggregate\n"
+               "  --json     Write the results of every match and the aggregated ones to the file\n"
+               "  --ticks    Maximum amount of updates to simulate per match (default: 360000)\n"
+               "  --dt       Time step of a single update in [s] (default: 0.01)\n"
+               "  --phased   Let all units think in parallel on the same state and apply the actions in global id order\n"
+               "  --think-threads  Amount of threads for the Think phase of the phased update (default: 1)\n"
+               "  --random-streams Draw the random numbers of every unit from its own stream keyed by (seed, gid, tick, purpose)\n"
+               "  --trace    Write the timing zones of a single match as Chrome trace (needs -DENABLE_PROFILER=ON)\n"
+               "  --record   Record the actions of a single match to a replay file\n"
+               "  --replay   Play the replay file again and verify every update against the recording (ignores the other game options)\n"
+               "  --snapshot Save the state of a single match after the last update to the file\n"
+               "  --restore  Continue the match saved in the snapshot file instead of starting a new one (ignores --seed)\n"
+               "  --verbose  Print the game log\n",
+               executable);
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    uint64_t seed = 0;
+    size_t seedCount = 1;
+    size_t threadCount = 0;
+    std::string csvPath;
+    std::string jsonPath;
+    std::string tracePath;
+    std::string recordPath;
+    std::string replayPath;
+    std::string snapshotPath;
+    std::string restorePath;
+    size_t ticks = 360'000;
+    float timeStep = 1e-2F;
+    bool verbose = false;
+
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string_view arg = argv[i];
+            if (arg == "--verbose")
+            {
+                verbose = true;
+                continue;
+            }
+            if (arg == "--phased")
+            {
+                oop::glob::game::PHASED_UPDATE = true;
+                continue;
+            }
+            if (arg == "--random-streams")
+            {
+                oop::glob::game::RANDOM_STREAMS = true;
+                continue;
+            }
+            if (arg == "--help" || arg == "-h" || i + 1 >= argc)
+            {
+                PrintUsage(argv[0]);
+                return arg == "--help" || arg == "-h" ? EXIT_SUCCESS : EXIT_FAILURE;
+            }
+
+            std::string value = argv[++i];
+            if (arg == "--seed")
+            {
+                seed = std::stoull(value);
+            }
+            else if (arg == "--seeds")
+            {
+                seedCount = std::stoull(value);
+            }
+            else if (arg == "--threads")
+            {
+                threadCount = std::stoull(value);
+            }
+            else if (arg == "--csv")
+            {
+                csvPath = value;
+            }
+            else if (arg == "--json")
+            {
+                jsonPath = value;
+            }
+            else if (arg == "--trace")
+            {
+                tracePath = value;
+            }
+            else if (arg == "--record")
+            {
+                recordPath = value;
+            }
+            else if (arg == "--replay")
+            {
+                replayPath = value;
+            }
+            else if (arg == "--snapshot")
+            {
+                snapshotPath = value;
+            }
+            else if (arg == "--restore")
+            {
+                restorePath = value;
+            }
+            else if (arg == "--think-threads")
+            {
+                oop::glob::game::THINK_THREADS = std::stoull(value);
+            }
+            else if (arg == "--ticks")
+            {
+                ticks = std::stoull(value);
+            }
+            else if (arg == "--dt")
+            {
+                timeStep = std::stof(value);
+            }
+            else
+            {
+                PrintUsage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        fmt::print(stderr, "Invalid argument: {}\n", e.what());
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (timeStep <= 0.0F)
+    {
+        fmt::print(stderr, "The time step has to be positive\n");
+        return EXIT_FAILURE;
+    }
+    if (seedCount == 0)
+    {
+        fmt::print(stderr, "At least one seed has to be played\n");
+        return EXIT_FAILURE;
+    }
+    if (!recordPath.empty() && (seedCount > 1 || !csvPath.empty() || !jsonPath.empty()))
+    {
+        fmt::print(stderr, "Only a single match can be recorded\n");
+        return EXIT_FAILURE;
+    }
+    if ((!snapshotPath.empty() || !restorePath.empty()) && (seedCount > 1 || !csvPath.empty() || !jsonPath.empty()))
+    {
+        fmt::print(stderr, "Snapshots can only be saved and restored for a single match\n");
+        return EXIT_FAILURE;
+    }
+    if (!recordPath.empty() && !restorePath.empty())
+    {
+        fmt::print(stderr, "Replays start with a new match, so a restored match can not be recorded\n");
+        return EXIT_FAILURE;
+    }
+
+    auto console_sink = spdlog::stderr_color_mt("console");
+    console_sink->set_level(verbose ? spdlog::level::debug : spdlog::level::warn);
+    console_sink->set_pattern("[%H:%M:%S.%e] [%^%L%$] %v");
+    spdlog::set_default_logger(console_sink);
+
+    if (!tracePath.empty() && !oop::internal::Profiler::ENABLED)
+    {
+        fmt::print(stderr, "The profiler is disabled in this build, so the trace will be empty (configure with -DENABLE_PROFILER=ON)\n");
+    }
+
+    if (!replayPath.empty())
+    {
+        return oop::internal::Replay::Play(replayPath);
+    }
+    if (seedCount > 1 || !csvPath.empty() || !jsonPath.empty())
+    {
+        return oop::internal::Tournament::Run(seed, seedCount, threadCount, ticks, timeStep, csvPath, jsonPath);
+    }
+    return oop::internal::HeadlessApplication::Run(seed, ticks, timeStep, tracePath, recordPath, restorePath, snapshotPath);
+}